@@ -20,6 +20,14 @@ limitations under the License.
 UVFProjectSettingsBase::UVFProjectSettingsBase()
 {
 	ProjectFrameRate = FFrameRate(24, 1);
+	bMeasureUVHalfPrecisionError = false;
+	LEDProcessorResolution = FIntPoint(3840, 2160);
+	MaxUVHalfPrecisionErrorTexels = 0.25f;
+	NDisplayProjectionUVChannel = 0;
+	MaxUVOverlapPercent = 0.1f;
+	bCompareOCIOTransformsNumerically = false;
+	MaxOCIODeltaE = 1.0f;
+	MaxColorPipelineDeltaE = 1.0f;
 }
 
 UVFProjectSettingsBase::~UVFProjectSettingsBase()
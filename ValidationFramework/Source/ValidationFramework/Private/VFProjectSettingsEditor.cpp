@@ -17,6 +17,30 @@ limitations under the License.
 
 #include "VFProjectSettingsEditor.h"
 
+#include "ValidationMeshExclusions.h"
+
+
 UVFProjectSettingsEditor::UVFProjectSettingsEditor(const FObjectInitializer& obj)
 {
+	NDisplayMeshExclusionNames = {
+		FName("SM_CineCam"),
+		FName("sm_nDisplayXform"),
+		FName("SM_nDisplayOrigin")
+	};
+}
+
+void UVFProjectSettingsEditor::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+	FValidationMeshExclusions::InvalidateProjectSettings();
+}
+
+#if WITH_EDITOR
+void UVFProjectSettingsEditor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// The mesh exclusions are compiled once from these settings and reused, so have to be compiled again
+	FValidationMeshExclusions::InvalidateProjectSettings();
 }
+#endif
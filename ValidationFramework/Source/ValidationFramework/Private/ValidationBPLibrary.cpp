@@ -19,10 +19,18 @@ limitations under the License.
 
 #include "GeneralEngineSettings.h"
 #include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
+#include "ValidationMeshExclusions.h"
+#include "ValidationOCIOResolver.h"
+#include "ValidationRegistrySubsystem.h"
+#include "ValidationRunContext.h"
+#include "ValidationScheduler.h"
 #include "VFProjectSettingsEditor.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/RendererSettings.h"
 #include "Interfaces/IPluginManager.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/JsonSerializer.h"
 #include "EditorLevelLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -34,6 +42,7 @@ limitations under the License.
 
 #include "Misc/FileHelper.h"
 #include "Subsystems/UnrealEditorSubsystem.h"
+#include "UObject/GCObjectScopeGuard.h"
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 #include "DisplayClusterRootActor.h"
 #include "DisplayClusterConfigurationTypes.h"
@@ -50,123 +59,84 @@ UValidationBPLibrary::UValidationBPLibrary(const FObjectInitializer& ObjectIniti
 }
 TArray<UObject*> UValidationBPLibrary::GetAllValidations()
 {
-	TArray<UObject*> ValidationObjects;
-	const TArray<UObject*> ValidationObjectsCode = GetAllValidationsFromCode();
-	const TArray<UObject*> ValidationObjectsBP = GetAllValidationsFromBlueprints();
-
-	ValidationObjects += ValidationObjectsCode;
-	ValidationObjects += ValidationObjectsBP;
-	return ValidationObjects;
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (Registry == nullptr)
+	{
+		return TArray<UObject*>();
+	}
+	return Registry->GetAllValidations();
 }
 
-TArray<UObject*> UValidationBPLibrary::GetAllValidationsFromCode()
+TFuture<TArray<UObject*>> UValidationBPLibrary::GetAllValidationsAsync()
 {
-	TArray<UObject*> ValidationObjects;
-	for(TObjectIterator< UClass > ClassIt; ClassIt; ++ClassIt)
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (Registry == nullptr)
 	{
-		const UClass* Class = *ClassIt;
-
-		// Only interested in native C++ classes
-		if(!Class->IsNative())
-		{
-			continue;
-		}
-
-		// Ignore deprecated
-		if(Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
-		{
-			continue;
-		}
-
-		// Check this class is a subclass of Base
-		if(!Class->IsChildOf(UValidationBase::StaticClass()))
-		{
-			continue;
-		}
-
-		// TODO This is horrible, but the UClass abstract flag check does not work because it also gets inherited so the base class
-		// TODO and all the validations which inherit also show as abstract
-		if( Class->GetName() == "ValidationBase")
-		{
-			continue;
-		}
-		UObject* Object = Class->GetDefaultObject();
-		ValidationObjects.Add(Object);
+		return MakeFulfilledPromise<TArray<UObject*>>().GetFuture();
 	}
-	
-	return ValidationObjects;
+	return Registry->RequestAllValidations();
 }
 
-TArray<UObject*> UValidationBPLibrary::GetAllValidationsFromBlueprints()
+TArray<UObject*> UValidationBPLibrary::GetValidations(const int32 WorkflowMask, const int32 ScopeMask)
 {
-	TArray<UObject*> ValidationObjects;
-
-	// Load the asset registry module
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked< FAssetRegistryModule >(FName("AssetRegistry"));
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-	// The asset registry is populated asynchronously at startup, so there's no guarantee it has finished.
-	// This simple approach just runs a synchronous scan on the entire content directory.
-	// Better solutions would be to specify only the path to where the relevant blueprints are,
-	// or to register a callback with the asset registry to be notified of when it's finished populating.
-	FString PluginContentDir = IPluginManager::Get().FindPlugin(TEXT("ValidationFramework"))->GetContentDir();
-	TArray< FString > ContentPaths;
-	ContentPaths.Add(TEXT("/Game"));
-	//ContentPaths.Add(PluginContentDir);
-	AssetRegistry.ScanPathsSynchronous(ContentPaths);
-
-	FTopLevelAssetPath BaseClassName = UValidationBase::StaticClass()->GetClassPathName();
-
-	// Use the asset registry to get the set of all class names deriving from Base
-	TSet< FTopLevelAssetPath > DerivedPaths;
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (Registry == nullptr)
 	{
-		TArray< FTopLevelAssetPath > BaseNames;
-		BaseNames.Add(BaseClassName);
-
-		TSet< FTopLevelAssetPath > Excluded;
-		AssetRegistry.GetDerivedClassNames(BaseNames, Excluded, DerivedPaths);
+		return TArray<UObject*>();
 	}
+	return TArray<UObject*>(Registry->GetValidations(static_cast<uint32>(WorkflowMask), static_cast<uint32>(ScopeMask)));
+}
 
-	TSet< FName > DerivedNames;
-	for(auto const& DerivedPath : DerivedPaths)
+TArray<FValidationResult> UValidationBPLibrary::RunValidations(const TArray<UObject*>& Validations)
+{
+	TArray<UValidationBase*> ValidationsToRun;
+	ValidationsToRun.Reserve(Validations.Num());
+	for (UObject* Item : Validations)
 	{
-		DerivedNames.Add(DerivedPath.GetAssetName());
+		ValidationsToRun.Add(Cast<UValidationBase>(Item));
 	}
 
-	FARFilter Filter;
-	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-	Filter.bRecursiveClasses = true;
-	Filter.bRecursivePaths = true;
+	return FValidationScheduler::RunValidations(ValidationsToRun);
+}
 
-	TArray< FAssetData > AssetList;
-	AssetRegistry.GetAssets(Filter, AssetList);
+TArray<FValidationFixResult> UValidationBPLibrary::RunFixes(const TArray<UObject*>& Validations)
+{
+	TArray<UValidationBase*> ValidationsToFix;
+	ValidationsToFix.Reserve(Validations.Num());
+	for (UObject* Item : Validations)
+	{
+		ValidationsToFix.Add(Cast<UValidationBase>(Item));
+	}
 
+	return FValidationScheduler::RunFixes(ValidationsToFix);
+}
 
-	// Iterate over retrieved blueprint assets
-	for(auto const& Asset : AssetList)
+TArray<UObject*> UValidationBPLibrary::GetAllValidationsFromCode()
+{
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (Registry == nullptr)
 	{
-		// Get the the class this blueprint generates (this is stored as a full path)
-		FAssetTagValueRef Result = Asset.TagsAndValues.FindTag(TEXT("GeneratedClass"));
-		FAssetRegistryExportPath ExportPath = Result.AsExportPath();
-		if(!ExportPath.ToString().IsEmpty())
-		{
-			// Convert path to just the name part
-			const FString ClassObjectPath = FPackageName::ExportTextPathToObjectPath(ExportPath.ToString());
-			const FString ClassName = FPackageName::ObjectPathToObjectName(ClassObjectPath);
-		
-			// Check if this class is in the derived set
-			if(!DerivedNames.Contains(*ClassName))
-			{
-				continue;
-			}
+		return TArray<UObject*>();
+	}
+	return Registry->GetCodeValidations();
+}
 
-			FSoftObjectPath SoftPath = FSoftObjectPath(ClassObjectPath);
-			TSoftClassPtr<UObject> AssetSubclass = TSoftClassPtr<UObject>(SoftPath);
-			UClass* ClassLoaded = AssetSubclass.LoadSynchronous();
-			UObject* Object = ClassLoaded->GetDefaultObject();
-			ValidationObjects.Add(Object);
-		}
+TArray<UObject*> UValidationBPLibrary::GetAllValidationsFromBlueprints()
+{
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (Registry == nullptr)
+	{
+		return TArray<UObject*>();
+	}
+	return Registry->GetBlueprintValidations();
+}
+
+void UValidationBPLibrary::RefreshValidationRegistry()
+{
+	if (UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get())
+	{
+		Registry->InvalidateRegistry();
 	}
-	return ValidationObjects;
 }
 
 UObject* UValidationBPLibrary::GetValidationFrameworkProjectSettings()
@@ -506,23 +476,30 @@ bool UValidationBPLibrary::ExcludeMeshFromNDisplayValidation(const UStaticMesh*
 	//TODO: exist in the code, which forces me to use get components which retrieves meshes which are not
 	//TODO: part of the nDisplay setup but part of say the camera, or the origin display.
 	
-	const FString FullName =  Mesh->GetFullName();
-	if (FullName.Contains("SM_CineCam"))
-	{
-		return true;
-	}
-	
-	if (FullName.Contains("sm_nDisplayXform"))
+	return GetNDisplayMeshExclusions()->IsMeshExcluded(Mesh);
+}
+
+bool UValidationBPLibrary::ExcludeMeshAssetFromNDisplayValidation(const FAssetData& MeshAsset)
+{
+	return GetNDisplayMeshExclusions()->IsMeshAssetExcluded(MeshAsset);
+}
+
+TSharedRef<const FValidationMeshExclusions> UValidationBPLibrary::GetNDisplayMeshExclusions()
+{
+	if (const FValidationRunContext* RunContext = FValidationRunContext::Get())
 	{
-		return true;
+		return RunContext->GetMeshExclusions();
 	}
+	return FValidationMeshExclusions::CompileProjectSettings();
+}
 
-	if (FullName.Contains("SM_nDisplayOrigin"))
+TSharedRef<FValidationOCIOResolver> UValidationBPLibrary::GetOCIOResolver()
+{
+	if (const FValidationRunContext* RunContext = FValidationRunContext::Get())
 	{
-		return true;
+		return RunContext->GetOCIOResolver();
 	}
-
-	return false;
+	return MakeShared<FValidationOCIOResolver>();
 }
 
 FValidationResult UValidationBPLibrary::ValidatePostProcessBloomSettings(const FString ObjectName, const FPostProcessSettings Settings)
@@ -1167,6 +1144,29 @@ FPostProcessSettings UValidationBPLibrary::FixPostProcessLocalExposureSettings(F
 	return Settings;
 }
 
+void UValidationBPLibrary::GetAllActorsOfClassForValidation(const UWorld* World, TSubclassOf<AActor> ActorClass, TArray<AActor*>& OutActors)
+{
+	OutActors.Reset();
+	if (World == nullptr || ActorClass == nullptr)
+	{
+		return;
+	}
+
+	FValidationRunContext* RunContext = FValidationRunContext::Get();
+	if (RunContext && RunContext->GetWorld() == World)
+	{
+		OutActors = RunContext->GetWorldSnapshot()->GetActorsOfClass(ActorClass);
+		return;
+	}
+
+	// Walking the world is only safe on the game thread, thread safe validations are always run within a run context
+	if (!ensureMsgf(IsInGameThread(), TEXT("Validations run off the game thread must be run within a FValidationRunContext")))
+	{
+		return;
+	}
+	UGameplayStatics::GetAllActorsOfClass(World, ActorClass, OutActors);
+}
+
 FValidationResult UValidationBPLibrary::NDisplayMeshSettingsValidation(
 	const UWorld* World,
 	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> InputValidationFunction)
@@ -1176,7 +1176,8 @@ FValidationResult UValidationBPLibrary::NDisplayMeshSettingsValidation(
 	FString Message = "";
 	
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+	GetAllActorsOfClassForValidation(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+	const TSharedRef<const FValidationMeshExclusions> MeshExclusions = GetNDisplayMeshExclusions();
 
 	for (AActor* FoundActor : FoundActors)
 	{
@@ -1186,7 +1187,8 @@ FValidationResult UValidationBPLibrary::NDisplayMeshSettingsValidation(
 		for (UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
 		{
 			UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
-			const bool ExcludeMesh = ExcludeMeshFromNDisplayValidation(StaticMesh);
+			const bool ExcludeMesh = StaticMesh == nullptr || MeshExclusions->IsComponentExcluded(StaticMeshComponent)
+				|| MeshExclusions->IsMeshExcluded(StaticMesh);
 			if (ExcludeMesh)
 			{
 				continue;
@@ -1222,6 +1224,17 @@ FValidationResult UValidationBPLibrary::NDisplayMeshSettingsValidation(
 	
 }
 
+TSharedRef<const FValidationMeshAnalysis> UValidationBPLibrary::GetNDisplayMeshAnalysis(const UWorld* World,
+	const uint32 UVLayoutChannelMask)
+{
+	FValidationRunContext* RunContext = FValidationRunContext::Get();
+	if (RunContext != nullptr && RunContext->GetWorld() == World)
+	{
+		return RunContext->GetMeshAnalysis(UVLayoutChannelMask);
+	}
+	return MakeShared<FValidationMeshAnalysis>(World, UVLayoutChannelMask);
+}
+
 bool UValidationBPLibrary::ExportValidationReport(UValidationReportDataTable* ValidationReportDataTable, FString ReportPath, const FString Suffix)
 {
 	UWorld* World = GEditor ? GEditor->GetEditorWorldContext(false).World() : nullptr;
@@ -1280,9 +1293,122 @@ UValidationReportDataTable* UValidationBPLibrary::CreateValidationDataTable()
 	return ValidationReportDataTable;
 }
 
-void UValidationBPLibrary::AddValidationResultToReport(UValidationReportDataTable* ValidationReportDataTable, UValidationBase* Validation, FValidationResult ValidationResult)
+FString UValidationBPLibrary::GetValidationReportRowName(const FValidationReportRow& ValidationReportRow)
+{
+	return ValidationReportRow.Level.IsEmpty()
+		? ValidationReportRow.Name : ValidationReportRow.Level + "." + ValidationReportRow.Name;
+}
+
+bool UValidationBPLibrary::ImportValidationReport(const FString& ReportPath, TArray<FValidationReportRow>& OutRows)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *(ReportPath + ".json")))
+	{
+		return false;
+	}
+
+	// The exported row name and the Name property share a json key, so read the rows directly rather than
+	// importing into a DataTable and rebuild the level qualified row names from the row contents
+	TArray<TSharedPtr<FJsonValue>> JsonRows;
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonRows))
+	{
+		return false;
+	}
+
+	OutRows.Reset(JsonRows.Num());
+	for (const TSharedPtr<FJsonValue>& JsonRow : JsonRows)
+	{
+		const TSharedPtr<FJsonObject>* JsonObject = nullptr;
+		if (!JsonRow.IsValid() || !JsonRow->TryGetObject(JsonObject))
+		{
+			return false;
+		}
+
+		FValidationReportRow& Row = OutRows.AddDefaulted_GetRef();
+		if (!FJsonObjectConverter::JsonObjectToUStruct(JsonObject->ToSharedRef(), &Row))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+UValidationReportDataTable* UValidationBPLibrary::MergeValidationReports(
+	const TArray<FString>& ReportPaths, const TArray<FString>& LevelPaths, EValidationStatus& OutWorstStatus)
+{
+	OutWorstStatus = EValidationStatus::Pass;
+
+	TArray<FValidationReportRow> Rows;
+	TArray<FValidationReportRow> ReportRows;
+	for (const FString& ReportPath : ReportPaths)
+	{
+		if (!ImportValidationReport(ReportPath, ReportRows))
+		{
+			return nullptr;
+		}
+		Rows.Append(MoveTemp(ReportRows));
+	}
+	return MergeValidationReportRows(MoveTemp(Rows), LevelPaths, OutWorstStatus);
+}
+
+UValidationReportDataTable* UValidationBPLibrary::MergeValidationReportRows(
+	TArray<FValidationReportRow> ReportRows, const TArray<FString>& LevelPaths, EValidationStatus& OutWorstStatus)
+{
+	OutWorstStatus = EValidationStatus::Pass;
+
+	// Key every row by its level qualified name, so duplicates collapse into the first one seen
+	TArray<FName> ProjectRowNames;
+	TMap<FString, TArray<FName>> LevelRowNames;
+	TMap<FName, FValidationReportRow> Rows;
+	for (FValidationReportRow& Row : ReportRows)
+	{
+		const FName RowName(*GetValidationReportRowName(Row));
+		if (Rows.Contains(RowName))
+		{
+			continue;
+		}
+		(Row.Level.IsEmpty() ? ProjectRowNames : LevelRowNames.FindOrAdd(Row.Level)).Add(RowName);
+		Rows.Add(RowName, MoveTemp(Row));
+	}
+
+	UValidationReportDataTable* MergedReport = NewObject<UValidationReportDataTable>(
+		GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UValidationReportDataTable::StaticClass(),
+			TEXT("ValidationDataTableMergedReport")));
+	MergedReport->RowStruct = Cast<UScriptStruct>(FValidationReportRow::StaticStruct());
+
+	auto AddRows = [&Rows, &OutWorstStatus, MergedReport](const TArray<FName>& RowNames)
+	{
+		for (const FName& RowName : RowNames)
+		{
+			const FValidationReportRow& Row = Rows.FindChecked(RowName);
+			if (Row.Result == "Fail")
+			{
+				OutWorstStatus = EValidationStatus::Fail;
+			}
+			else if (Row.Result == "Warning")
+			{
+				OutWorstStatus = FMath::Min(OutWorstStatus, EValidationStatus::Warning);
+			}
+			MergedReport->AddRow(RowName, Row);
+		}
+	};
+
+	AddRows(ProjectRowNames);
+	for (const FString& LevelPath : LevelPaths)
+	{
+		if (const TArray<FName>* RowNames = LevelRowNames.Find(LevelPath))
+		{
+			AddRows(*RowNames);
+		}
+	}
+	return MergedReport;
+}
+
+void UValidationBPLibrary::AddValidationResultToReport(UValidationReportDataTable* ValidationReportDataTable, UValidationBase* Validation, FValidationResult ValidationResult, const FString Level)
 {
 	FValidationReportRow ValidationReportRow = FValidationReportRow();
+	ValidationReportRow.Level = Level;
 	ValidationReportRow.Name = Validation->ValidationName;
 	if (ValidationResult.Result == EValidationStatus::Pass)
 	{
@@ -1301,12 +1427,21 @@ void UValidationBPLibrary::AddValidationResultToReport(UValidationReportDataTabl
 	ValidationReportRow.Description = Validation->ValidationDescription;
 	ValidationReportRow.Fix = Validation->FixDescription;
 		
-	// Add Report Item As A New Row
-	ValidationReportDataTable->AddRow(FName(*ValidationReportRow.Name), ValidationReportRow);
+	// Add Report Item As A New Row, qualifying the name with the level so rows stay unique across levels
+	ValidationReportDataTable->AddRow(FName(*GetValidationReportRowName(ValidationReportRow)), ValidationReportRow);
 }
 
 bool UValidationBPLibrary::GenerateValidationReport(const FString LevelPath, const EValidationWorkflow Workflow, const FString ReportPath)
 {
+	EValidationStatus WorstStatus;
+	return GenerateValidationReportForWorkflows(LevelPath, ValidationWorkflowToMask(Workflow), ReportPath, WorstStatus);
+}
+
+bool UValidationBPLibrary::GenerateValidationReportForWorkflows(
+	const FString& LevelPath, const uint32 WorkflowMask, const FString& ReportPath, EValidationStatus& OutWorstStatus)
+{
+	OutWorstStatus = EValidationStatus::Pass;
+
 	bool const LoadResult = FEditorFileUtils::LoadMap(LevelPath, false, false);
 	if (!LoadResult)
 	{
@@ -1319,21 +1454,95 @@ bool UValidationBPLibrary::GenerateValidationReport(const FString LevelPath, con
 		return false;
 	}
 	
-	TArray<UObject*> Validations = GetAllValidations();
-	for (UObject* Item : Validations)
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (!Registry)
+	{
+		return false;
+	}
+
+	// Copied as running the validations could cause the registry to be rebuilt
+	const TArray<UValidationBase*> Validations = Registry->GetValidations(WorkflowMask, ValidationMaskAll);
+	const TArray<FValidationResult> Results = FValidationScheduler::RunValidations(Validations);
+	for (int32 Index = 0; Index < Validations.Num(); ++Index)
 	{
-		UValidationBase* Validation = Cast<UValidationBase>(Item);
-		if (!Validation->ValidationApplicableWorkflows.Contains(Workflow))
+		AddValidationResultToReport(ValidationReportDataTable, Validations[Index], Results[Index]);
+		OutWorstStatus = FMath::Min(OutWorstStatus, Results[Index].Result);
+	}
+	
+	return ExportValidationReport(ValidationReportDataTable, ReportPath);
+}
+
+bool UValidationBPLibrary::GenerateBatchValidationReport(const TArray<FString>& LevelPaths, const EValidationWorkflow Workflow, const FString ReportPath)
+{
+	EValidationStatus WorstStatus;
+	return GenerateBatchValidationReportForWorkflows(LevelPaths, ValidationWorkflowToMask(Workflow), ReportPath, WorstStatus);
+}
+
+bool UValidationBPLibrary::GenerateBatchValidationReportForWorkflows(
+	const TArray<FString>& LevelPaths, const uint32 WorkflowMask, const FString& ReportPath, EValidationStatus& OutWorstStatus)
+{
+	OutWorstStatus = EValidationStatus::Pass;
+
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (!Registry)
+	{
+		return false;
+	}
+
+	// The report outlives the levels we load, so it cannot be outered to the editor world like a single level report
+	UValidationReportDataTable* ValidationReportDataTable = NewObject<UValidationReportDataTable>(
+		GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UValidationReportDataTable::StaticClass(),
+			TEXT("ValidationDataTableBatchReport")));
+	ValidationReportDataTable->RowStruct = Cast<UScriptStruct>(FValidationReportRow::StaticStruct());
+	FGCObjectScopeGuard ReportGuard(ValidationReportDataTable);
+
+	// Project validations do not depend on the level so are only run once for the whole batch
+	const TArray<UValidationBase*> ProjectValidations = Registry->GetValidations(
+		WorkflowMask, ValidationScopeToMask(EValidationScope::Project));
+	const TArray<FValidationResult> ProjectResults = FValidationScheduler::RunValidations(ProjectValidations);
+	for (int32 Index = 0; Index < ProjectValidations.Num(); ++Index)
+	{
+		AddValidationResultToReport(ValidationReportDataTable, ProjectValidations[Index], ProjectResults[Index]);
+		OutWorstStatus = FMath::Min(OutWorstStatus, ProjectResults[Index].Result);
+	}
+
+	bool bAllLevelsValidated = true;
+	for (const FString& LevelPath : LevelPaths)
+	{
+		if (!FEditorFileUtils::LoadMap(LevelPath, false, false))
 		{
+			bAllLevelsValidated = false;
 			continue;
 		}
-		
-		const FValidationResult Result = Validation->RunValidation();
-		
-		AddValidationResultToReport(ValidationReportDataTable, Validation, Result);
+
+		// Copied as running the validations could cause the registry to be rebuilt
+		const TArray<UValidationBase*> LevelValidations = Registry->GetValidations(
+			WorkflowMask, ValidationScopeToMask(EValidationScope::Level));
+
+		// Level validations which depend on project validations reuse the results from the start of the batch
+		FValidationRunContext RunContext(UValidationBase::GetCorrectValidationWorld());
+		for (int32 Index = 0; Index < ProjectValidations.Num(); ++Index)
+		{
+			RunContext.AddValidationResult(ProjectValidations[Index], ProjectResults[Index]);
+		}
+
+		const TArray<FValidationResult> LevelResults = FValidationScheduler::RunValidations(LevelValidations);
+		for (int32 Index = 0; Index < LevelValidations.Num(); ++Index)
+		{
+			AddValidationResultToReport(ValidationReportDataTable, LevelValidations[Index], LevelResults[Index], LevelPath);
+			OutWorstStatus = FMath::Min(OutWorstStatus, LevelResults[Index].Result);
+		}
 	}
-	
-	return ExportValidationReport(ValidationReportDataTable, ReportPath);
+
+	FString BatchReportPath = ReportPath;
+	if (BatchReportPath.IsEmpty())
+	{
+		const FString ValidationBatchReportFolder = FPaths::Combine(FPaths::ProjectDir(), TEXT("ValidationReports"), TEXT("Batch"));
+		IFileManager::Get().MakeDirectory(*ValidationBatchReportFolder, true);
+		BatchReportPath = FPaths::Combine(ValidationBatchReportFolder, TEXT("Batch"));
+	}
+
+	return ExportValidationReport(ValidationReportDataTable, BatchReportPath) && bAllLevelsValidated;
 }
 
 FValidationResult UValidationBPLibrary::ValidateSequencesAgainstFrameRate( const UWorld* World, const FFrameRate Rate)
@@ -1348,7 +1557,7 @@ FValidationResult UValidationBPLibrary::ValidateSequencesAgainstFrameRate( const
 	}
 
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ALevelSequenceActor::StaticClass(), FoundActors);
+	GetAllActorsOfClassForValidation(World, ALevelSequenceActor::StaticClass(), FoundActors);
 	for (const auto FoundActor : FoundActors)
 	{
 		FValidationResult ActorValidationResult = FValidationResult(EValidationStatus::Pass, "");
@@ -1399,7 +1608,7 @@ FValidationFixResult UValidationBPLibrary::FixSequencesAgainstFrameRate( const U
 	}
 
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ALevelSequenceActor::StaticClass(), FoundActors);
+	GetAllActorsOfClassForValidation(World, ALevelSequenceActor::StaticClass(), FoundActors);
 	for (const auto FoundActor : FoundActors)
 	{
 		FValidationFixResult ActorValidationFixResult = FValidationFixResult(EValidationFixStatus::Fixed, "");
@@ -16,6 +16,7 @@ limitations under the License.
 
 
 #include "ValidationBase.h"
+#include "ValidationRunContext.h"
 
 #include "Editor.h"
 
@@ -30,14 +31,64 @@ UValidationBase::~UValidationBase()
 
 FValidationResult UValidationBase::RunValidation()
 {
+	if (FValidationRunContext* RunContext = FValidationRunContext::Get())
+	{
+		return RunContext->RunValidation(this);
+	}
 	return Validation();
 }
 
 FValidationFixResult UValidationBase::RunFix()
 {
+	if (FValidationRunContext* RunContext = FValidationRunContext::Get())
+	{
+		return RunContext->RunFix(this);
+	}
 	return Fix();
 }
 
+FValidationResult UValidationBase::RunDependency(TSubclassOf<UValidationBase> Dependency)
+{
+	UValidationBase* DependencyValidation = Dependency ? Dependency->GetDefaultObject<UValidationBase>() : nullptr;
+	if (DependencyValidation == nullptr)
+	{
+		return FValidationResult(EValidationStatus::Fail, "Invalid Validation Dependency");
+	}
+
+	if (!DependsOn(Dependency))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s Runs %s Without Declaring It As A Dependency"), *ValidationName, *DependencyValidation->ValidationName);
+	}
+	return DependencyValidation->RunValidation();
+}
+
+FValidationFixResult UValidationBase::RunDependencyFix(TSubclassOf<UValidationBase> Dependency)
+{
+	UValidationBase* DependencyValidation = Dependency ? Dependency->GetDefaultObject<UValidationBase>() : nullptr;
+	if (DependencyValidation == nullptr)
+	{
+		return FValidationFixResult(EValidationFixStatus::NotFixed, "Invalid Validation Dependency");
+	}
+
+	if (!DependsOn(Dependency))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s Fixes %s Without Declaring It As A Dependency"), *ValidationName, *DependencyValidation->ValidationName);
+	}
+	return DependencyValidation->RunFix();
+}
+
+bool UValidationBase::DependsOn(const UClass* ValidationClass) const
+{
+	for (const TSubclassOf<UValidationBase>& Dependency : ValidationDependencies)
+	{
+		if (Dependency.Get() == ValidationClass)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 FValidationResult UValidationBase::Validation_Implementation()
 {
 	return FValidationResult(EValidationStatus::Pass, "Base Implementation");
@@ -49,6 +100,12 @@ FValidationFixResult UValidationBase::Fix_Implementation()
 
 }
 
+bool UValidationBase::CanRunValidationOffGameThread() const
+{
+	// Blueprint generated classes are never native, even if they derive from a thread safe c++ validation
+	return ValidationThreadSafety == EValidationThreadSafety::AnyThread && GetClass()->HasAnyClassFlags(CLASS_Native);
+}
+
 UWorld* UValidationBase::GetCorrectValidationWorld()
 {
 	return GEditor ? GEditor->GetEditorWorldContext(false).World() : nullptr;
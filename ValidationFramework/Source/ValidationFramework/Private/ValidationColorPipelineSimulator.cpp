@@ -0,0 +1,385 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationColorPipelineSimulator.h"
+
+#include "Async/ParallelFor.h"
+#include "ColorManagement/ColorSpace.h"
+#include "Engine/Scene.h"
+#include "Math/VectorRegister.h"
+#include "ValidationOCIOEquivalence.h"
+
+
+namespace ValidationColorPipeline
+{
+	/**
+	* A row major 3x3 matrix, the constants match those of the tonemapper
+	*/
+	struct FMatrix3
+	{
+		float M[9];
+
+		FMatrix3 operator*(const FMatrix3& Other) const
+		{
+			FMatrix3 Result;
+			for (int32 Row = 0; Row < 3; Row++)
+			{
+				for (int32 Column = 0; Column < 3; Column++)
+				{
+					Result.M[Row * 3 + Column] =
+						M[Row * 3] * Other.M[Column] +
+						M[Row * 3 + 1] * Other.M[3 + Column] +
+						M[Row * 3 + 2] * Other.M[6 + Column];
+				}
+			}
+			return Result;
+		}
+	};
+
+	const FMatrix3 AP0ToAP1 = {{
+		1.4514393161f, -0.2365107469f, -0.2149285693f,
+		-0.0765537734f, 1.1762296998f, -0.0996759264f,
+		0.0083161484f, -0.0060324498f, 0.9977163014f}};
+
+	const FMatrix3 AP1ToAP0 = {{
+		0.6954522414f, 0.1406786965f, 0.1638690622f,
+		0.0447945634f, 0.8596711185f, 0.0955343182f,
+		-0.0055258826f, 0.0040252103f, 1.0015006723f}};
+
+	const FMatrix3 BlueCorrect = {{
+		0.9404372683f, -0.0183068787f, 0.0778696104f,
+		0.0083786969f, 0.8286599939f, 0.1629613092f,
+		0.0005471261f, -0.0008833746f, 1.0003362486f}};
+
+	const FMatrix3 BlueCorrectInv = {{
+		1.06318f, 0.0233956f, -0.0865726f,
+		-0.0106337f, 1.20632f, -0.19569f,
+		-0.000590887f, 0.00105248f, 0.999538f}};
+
+	const FMatrix3 WideToXYZ = {{
+		0.5441691f, 0.2395926f, 0.1666943f,
+		0.2394656f, 0.7021530f, 0.0583814f,
+		-0.0023439f, 0.0361834f, 1.0552183f}};
+
+	const FMatrix3 XYZToAP1 = {{
+		1.6410233797f, -0.3248032942f, -0.2364246952f,
+		-0.6636628587f, 1.6153315917f, 0.0167563477f,
+		0.0117218943f, -0.0082844420f, 0.9883948585f}};
+
+	const FMatrix3 AP1ToSRGB = {{
+		1.70505f, -0.62179f, -0.08326f,
+		-0.13026f, 1.14080f, -0.01055f,
+		-0.02400f, -0.12897f, 1.15297f}};
+
+	const FVector3f AP1RGBToY(0.2722287168f, 0.6740817658f, 0.0536895174f);
+
+	/**
+	* A 3x3 matrix held as the columns of SIMD registers, so transforming a color is three multiply adds
+	*/
+	struct FVectorMatrix
+	{
+		VectorRegister4Float Columns[3];
+
+		explicit FVectorMatrix(const FMatrix3& Matrix)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				Columns[Column] = MakeVectorRegisterFloat(Matrix.M[Column], Matrix.M[3 + Column], Matrix.M[6 + Column], 0.f);
+			}
+		}
+
+		/**
+		* Builds the matrix of a linear color space transform from the transformed basis vectors
+		*/
+		explicit FVectorMatrix(const UE::Color::FColorSpaceTransform& Transform)
+		{
+			const FLinearColor Basis[] = {FLinearColor(1.f, 0.f, 0.f, 0.f), FLinearColor(0.f, 1.f, 0.f, 0.f), FLinearColor(0.f, 0.f, 1.f, 0.f)};
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				const FLinearColor Transformed = Transform.Apply(Basis[Column]);
+				Columns[Column] = MakeVectorRegisterFloat(Transformed.R, Transformed.G, Transformed.B, 0.f);
+			}
+		}
+
+		FORCEINLINE VectorRegister4Float Transform(const VectorRegister4Float Color) const
+		{
+			VectorRegister4Float Result = VectorMultiply(Columns[0], VectorReplicate(Color, 0));
+			Result = VectorMultiplyAdd(Columns[1], VectorReplicate(Color, 1), Result);
+			return VectorMultiplyAdd(Columns[2], VectorReplicate(Color, 2), Result);
+		}
+	};
+
+	/**
+	* The matrices of the pipeline, built for each evaluation so they follow the working color space of the project,
+	* which can change whilst the editor is running
+	*/
+	struct FPipelineMatrices
+	{
+		FVectorMatrix WorkingToAP1;
+		FVectorMatrix AP1ToWorking;
+		FVectorMatrix BlueCorrectAP1;
+		FVectorMatrix BlueCorrectInvAP1;
+		FVectorMatrix ExpandGamut;
+
+		FPipelineMatrices()
+			: WorkingToAP1(UE::Color::FColorSpaceTransform(UE::Color::FColorSpace::GetWorking(), UE::Color::FColorSpace(UE::Color::EColorSpace::ACESAP1)))
+			, AP1ToWorking(UE::Color::FColorSpaceTransform(UE::Color::FColorSpace(UE::Color::EColorSpace::ACESAP1), UE::Color::FColorSpace::GetWorking()))
+			, BlueCorrectAP1(AP0ToAP1 * BlueCorrect * AP1ToAP0)
+			, BlueCorrectInvAP1(AP0ToAP1 * BlueCorrectInv * AP1ToAP0)
+			, ExpandGamut(XYZToAP1 * WideToXYZ * AP1ToSRGB)
+		{
+		}
+	};
+
+	FORCEINLINE VectorRegister4Float Lerp(const VectorRegister4Float A, const VectorRegister4Float B, const VectorRegister4Float Alpha)
+	{
+		return VectorMultiplyAdd(VectorSubtract(B, A), Alpha, A);
+	}
+
+	FORCEINLINE float Luminance(const float* ColorAP1)
+	{
+		return ColorAP1[0] * AP1RGBToY.X + ColorAP1[1] * AP1RGBToY.Y + ColorAP1[2] * AP1RGBToY.Z;
+	}
+
+	/**
+	* The filmic curve of the tonemapper applied to a single channel, between its pre and post desaturation
+	*/
+	struct FFilmCurve
+	{
+		float Slope;
+		float BlackClip;
+		float WhiteClip;
+		float ToeScale;
+		float ShoulderScale;
+		float ToeMatch;
+		float StraightMatch;
+		float ShoulderMatch;
+
+		explicit FFilmCurve(const FValidationColorGrade& Grade)
+			: Slope(Grade.FilmSlope)
+			, BlackClip(Grade.FilmBlackClip)
+			, WhiteClip(Grade.FilmWhiteClip)
+			, ToeScale(1.f + Grade.FilmBlackClip - Grade.FilmToe)
+			, ShoulderScale(1.f + Grade.FilmWhiteClip - Grade.FilmShoulder)
+		{
+			constexpr float InMatch = 0.18f;
+			constexpr float OutMatch = 0.18f;
+			if (Grade.FilmToe > 0.8f)
+			{
+				ToeMatch = (1.f - Grade.FilmToe - OutMatch) / Slope + FMath::LogX(10.f, InMatch);
+			}
+			else
+			{
+				const float BT = (OutMatch + BlackClip) / ToeScale - 1.f;
+				ToeMatch = FMath::LogX(10.f, InMatch) - 0.5f * FMath::Loge((1.f + BT) / (1.f - BT)) * (ToeScale / Slope);
+			}
+			StraightMatch = (1.f - Grade.FilmToe) / Slope - ToeMatch;
+			ShoulderMatch = Grade.FilmShoulder / Slope - StraightMatch;
+		}
+
+		float Apply(const float Value) const
+		{
+			const float LogValue = FMath::LogX(10.f, FMath::Max(Value, UE_SMALL_NUMBER));
+			const float Straight = Slope * (LogValue + StraightMatch);
+			const float Toe = LogValue < ToeMatch
+				? -BlackClip + (2.f * ToeScale) / (1.f + FMath::Exp((-2.f * Slope / ToeScale) * (LogValue - ToeMatch)))
+				: Straight;
+			const float Shoulder = LogValue > ShoulderMatch
+				? (1.f + WhiteClip) - (2.f * ShoulderScale) / (1.f + FMath::Exp((2.f * Slope / ShoulderScale) * (LogValue - ShoulderMatch)))
+				: Straight;
+
+			float T = FMath::Clamp((LogValue - ToeMatch) / (ShoulderMatch - ToeMatch), 0.f, 1.f);
+			T = ShoulderMatch < ToeMatch ? 1.f - T : T;
+			T = (3.f - 2.f * T) * T * T;
+			return FMath::Lerp(Toe, Shoulder, T);
+		}
+
+		void Apply(float* ColorAP1) const
+		{
+			float Color[3];
+			const float PreLuminance = Luminance(ColorAP1);
+			for (int32 Channel = 0; Channel < 3; Channel++)
+			{
+				Color[Channel] = Apply(FMath::Lerp(PreLuminance, FMath::Max(ColorAP1[Channel], 0.f), 0.96f));
+			}
+
+			const float PostLuminance = Luminance(Color);
+			for (int32 Channel = 0; Channel < 3; Channel++)
+			{
+				ColorAP1[Channel] = FMath::Max(FMath::Lerp(PostLuminance, Color[Channel], 0.93f), 0.f);
+			}
+		}
+	};
+}
+
+void FValidationColorGrade::ApplyOverrides(const FPostProcessSettings& Settings)
+{
+	if (Settings.bOverride_AutoExposureBias) { ExposureBias = Settings.AutoExposureBias; }
+	if (Settings.bOverride_LocalExposureHighlightContrastScale) { LocalExposureHighlightContrastScale = Settings.LocalExposureHighlightContrastScale; }
+	if (Settings.bOverride_LocalExposureShadowContrastScale) { LocalExposureShadowContrastScale = Settings.LocalExposureShadowContrastScale; }
+	if (Settings.bOverride_LocalExposureMiddleGreyBias) { LocalExposureMiddleGreyBias = Settings.LocalExposureMiddleGreyBias; }
+	if (Settings.bOverride_BlueCorrection) { BlueCorrection = Settings.BlueCorrection; }
+	if (Settings.bOverride_ExpandGamut) { ExpandGamut = Settings.ExpandGamut; }
+	if (Settings.bOverride_ToneCurveAmount) { ToneCurveAmount = Settings.ToneCurveAmount; }
+	if (Settings.bOverride_FilmSlope) { FilmSlope = Settings.FilmSlope; }
+	if (Settings.bOverride_FilmToe) { FilmToe = Settings.FilmToe; }
+	if (Settings.bOverride_FilmShoulder) { FilmShoulder = Settings.FilmShoulder; }
+	if (Settings.bOverride_FilmBlackClip) { FilmBlackClip = Settings.FilmBlackClip; }
+	if (Settings.bOverride_FilmWhiteClip) { FilmWhiteClip = Settings.FilmWhiteClip; }
+}
+
+FValidationColorGrade FValidationColorGrade::EngineDefault()
+{
+	const FPostProcessSettings Defaults;
+	FValidationColorGrade Grade;
+	Grade.ExposureBias = Defaults.AutoExposureBias;
+	Grade.LocalExposureHighlightContrastScale = Defaults.LocalExposureHighlightContrastScale;
+	Grade.LocalExposureShadowContrastScale = Defaults.LocalExposureShadowContrastScale;
+	Grade.LocalExposureMiddleGreyBias = Defaults.LocalExposureMiddleGreyBias;
+	Grade.BlueCorrection = Defaults.BlueCorrection;
+	Grade.ExpandGamut = Defaults.ExpandGamut;
+	Grade.ToneCurveAmount = Defaults.ToneCurveAmount;
+	Grade.FilmSlope = Defaults.FilmSlope;
+	Grade.FilmToe = Defaults.FilmToe;
+	Grade.FilmShoulder = Defaults.FilmShoulder;
+	Grade.FilmBlackClip = Defaults.FilmBlackClip;
+	Grade.FilmWhiteClip = Defaults.FilmWhiteClip;
+	return Grade;
+}
+
+bool FValidationColorGrade::operator==(const FValidationColorGrade& Other) const
+{
+	return ExposureBias == Other.ExposureBias
+		&& LocalExposureHighlightContrastScale == Other.LocalExposureHighlightContrastScale
+		&& LocalExposureShadowContrastScale == Other.LocalExposureShadowContrastScale
+		&& LocalExposureMiddleGreyBias == Other.LocalExposureMiddleGreyBias
+		&& BlueCorrection == Other.BlueCorrection
+		&& ExpandGamut == Other.ExpandGamut
+		&& ToneCurveAmount == Other.ToneCurveAmount
+		&& FilmSlope == Other.FilmSlope
+		&& FilmToe == Other.FilmToe
+		&& FilmShoulder == Other.FilmShoulder
+		&& FilmBlackClip == Other.FilmBlackClip
+		&& FilmWhiteClip == Other.FilmWhiteClip;
+}
+
+uint32 GetTypeHash(const FValidationColorGrade& Grade)
+{
+	uint32 Hash = GetTypeHash(Grade.ExposureBias);
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.LocalExposureHighlightContrastScale));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.LocalExposureShadowContrastScale));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.LocalExposureMiddleGreyBias));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.BlueCorrection));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.ExpandGamut));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.ToneCurveAmount));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.FilmSlope));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.FilmToe));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.FilmShoulder));
+	Hash = HashCombineFast(Hash, GetTypeHash(Grade.FilmBlackClip));
+	return HashCombineFast(Hash, GetTypeHash(Grade.FilmWhiteClip));
+}
+
+TConstArrayView<FLinearColor> FValidationColorPipelineSimulator::GetTestPatches()
+{
+	return FValidationOCIOEquivalence::GetSamples();
+}
+
+void FValidationColorPipelineSimulator::EvaluateGrade(const FValidationColorGrade& Grade, TArrayView<FLinearColor> InOutColors)
+{
+	using namespace ValidationColorPipeline;
+	const FPipelineMatrices Matrices;
+	const FFilmCurve FilmCurve(Grade);
+
+	const VectorRegister4Float ExposureScale = VectorSetFloat1(FMath::Pow(2.f, Grade.ExposureBias));
+	const VectorRegister4Float BlueCorrection = VectorSetFloat1(Grade.BlueCorrection);
+	const VectorRegister4Float ToneCurveAmount = VectorSetFloat1(Grade.ToneCurveAmount);
+	const bool bLocalExposure = Grade.LocalExposureHighlightContrastScale != 1.f || Grade.LocalExposureShadowContrastScale != 1.f;
+	const float MiddleGreyLog2 = FMath::Log2(0.18f) + Grade.LocalExposureMiddleGreyBias;
+
+	const int32 NumBatches = FMath::DivideAndRoundUp(InOutColors.Num(), FValidationOCIOEquivalence::BatchSize);
+	ParallelFor(NumBatches, [&](const int32 BatchIndex)
+	{
+		const int32 Start = BatchIndex * FValidationOCIOEquivalence::BatchSize;
+		const int32 End = FMath::Min(Start + FValidationOCIOEquivalence::BatchSize, InOutColors.Num());
+		for (int32 Index = Start; Index < End; Index++)
+		{
+			FLinearColor& Color = InOutColors[Index];
+			VectorRegister4Float ColorAP1 = Matrices.WorkingToAP1.Transform(VectorMultiply(VectorLoad(&Color.R), ExposureScale));
+			alignas(16) float Channels[4];
+
+			// The test patches are flat so the blurred luminance local exposure works from is the patch luminance
+			if (bLocalExposure)
+			{
+				VectorStoreAligned(ColorAP1, Channels);
+				const float Luminance = ValidationColorPipeline::Luminance(Channels);
+				if (Luminance > 0.f)
+				{
+					const float LuminanceLog2 = FMath::Log2(Luminance) - MiddleGreyLog2;
+					const float ContrastScale = LuminanceLog2 > 0.f ? Grade.LocalExposureHighlightContrastScale : Grade.LocalExposureShadowContrastScale;
+					ColorAP1 = VectorMultiply(ColorAP1, VectorSetFloat1(FMath::Pow(2.f, LuminanceLog2 * (ContrastScale - 1.f))));
+				}
+			}
+
+			if (Grade.BlueCorrection != 0.f)
+			{
+				ColorAP1 = ValidationColorPipeline::Lerp(ColorAP1, Matrices.BlueCorrectAP1.Transform(ColorAP1), BlueCorrection);
+			}
+
+			if (Grade.ExpandGamut != 0.f)
+			{
+				VectorStoreAligned(ColorAP1, Channels);
+				const float Luminance = ValidationColorPipeline::Luminance(Channels);
+				if (Luminance > 0.f)
+				{
+					const VectorRegister4Float Chroma = VectorSubtract(VectorDivide(ColorAP1, VectorSetFloat1(Luminance)), VectorOne());
+					const float ChromaDistSqr = VectorGetComponent(VectorDot3(Chroma, Chroma), 0);
+					const float ExpandAmount = (1.f - FMath::Pow(2.f, -4.f * ChromaDistSqr)) *
+						(1.f - FMath::Pow(2.f, -4.f * Grade.ExpandGamut * Luminance * Luminance));
+					ColorAP1 = ValidationColorPipeline::Lerp(ColorAP1, Matrices.ExpandGamut.Transform(ColorAP1), VectorSetFloat1(ExpandAmount));
+				}
+			}
+
+			if (Grade.ToneCurveAmount != 0.f)
+			{
+				VectorStoreAligned(ColorAP1, Channels);
+				FilmCurve.Apply(Channels);
+				ColorAP1 = ValidationColorPipeline::Lerp(ColorAP1, VectorLoadAligned(Channels), ToneCurveAmount);
+			}
+
+			if (Grade.BlueCorrection != 0.f)
+			{
+				ColorAP1 = ValidationColorPipeline::Lerp(ColorAP1, Matrices.BlueCorrectInvAP1.Transform(ColorAP1), BlueCorrection);
+			}
+
+			const float Alpha = Color.A;
+			VectorStore(Matrices.AP1ToWorking.Transform(ColorAP1), &Color.R);
+			Color.A = Alpha;
+		}
+	});
+}
+
+bool FValidationColorPipelineSimulator::Simulate(
+	const FValidationColorGrade& Grade, const FOpenColorIOColorConversionSettings* OCIOSettings, TArray<FLinearColor>& OutColors)
+{
+	OutColors = GetTestPatches();
+	EvaluateGrade(Grade, OutColors);
+	if (OCIOSettings && !FValidationOCIOEquivalence::TransformColors(*OCIOSettings, OutColors))
+	{
+		OutColors.Reset();
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,536 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationCommandlet.h"
+
+#include "ValidationBPLibrary.h"
+#include "ValidationManifest.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogValidationCommandlet, Log, All);
+
+namespace ValidationCommandlet
+{
+	constexpr int32 ExitSuccess = 0;
+	constexpr int32 ExitValidationFailed = 1;
+	constexpr int32 ExitError = 2;
+
+	/**
+	* Splits a commandlet argument containing several values separated by + or ,
+	*/
+	TArray<FString> SplitArgument(const FString& Argument)
+	{
+		TArray<FString> Values;
+		const TCHAR* Delimiters[] = { TEXT("+"), TEXT(",") };
+		Argument.ParseIntoArray(Values, Delimiters, UE_ARRAY_COUNT(Delimiters), true);
+		for (FString& Value : Values)
+		{
+			Value.TrimStartAndEndInline();
+		}
+		Values.RemoveAll([](const FString& Value) { return Value.IsEmpty(); });
+		return Values;
+	}
+
+	/**
+	* A subset of the levels validated by its own worker process
+	*/
+	struct FValidationShard
+	{
+		TArray<FString> Levels;
+		FString ShardDir;
+		FProcHandle Process;
+		double LaunchTime = 0.0;
+		int32 Attempts = 0;
+		bool bComplete = false;
+	};
+
+	/**
+	* Starts a worker editor process which validates the levels of the given shard as a combined report in its shard
+	* directory, any report left by a previous attempt is removed first so a crashed worker can never be merged
+	*/
+	bool LaunchShard(FValidationShard& Shard, const FString& Workflows)
+	{
+		const FString LevelListPath = FPaths::Combine(Shard.ShardDir, TEXT("Levels.txt"));
+		IFileManager::Get().Delete(*FPaths::Combine(Shard.ShardDir, TEXT("Batch.json")), false, true, true);
+		IFileManager::Get().Delete(*FPaths::Combine(Shard.ShardDir, TEXT("Batch.csv")), false, true, true);
+		if (!FFileHelper::SaveStringArrayToFile(Shard.Levels, *LevelListPath))
+		{
+			return false;
+		}
+
+		// Each worker logs to its own file so that concurrent workers do not contend for the project log
+		const FString WorkerParams = FString::Printf(
+			TEXT("\"%s\" -run=Validation -LevelList=\"%s\" -Workflows=%s -ReportDir=\"%s\" -FailOn=Never -Combined ")
+			TEXT("-abslog=\"%s\" -nullrhi -unattended -nosplash -nopause"),
+			*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()), *LevelListPath, *Workflows, *Shard.ShardDir,
+			*FPaths::Combine(Shard.ShardDir, FString::Printf(TEXT("Attempt%d.log"), Shard.Attempts)));
+
+		Shard.Attempts++;
+		Shard.LaunchTime = FPlatformTime::Seconds();
+		Shard.Process = FPlatformProcess::CreateProc(
+			FPlatformProcess::ExecutablePath(), *WorkerParams, false, true, true, nullptr, 0, nullptr, nullptr);
+		return Shard.Process.IsValid();
+	}
+}
+
+UValidationCommandlet::UValidationCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+	HelpDescription = TEXT("Generates validation reports for the given levels and workflows");
+	HelpUsage = TEXT("-run=Validation -Levels=/Game/Maps/Level1+/Game/Maps/Level2 [-LevelList=Levels.txt] "
+		"[-Workflows=ICVFX+VAD] [-ReportDir=Path] [-FailOn=Fail|Warning|Never] [-Combined] [-Shards=N] [-ShardRetries=N] "
+		"[-ShardTimeout=Seconds] [-Incremental] [-Manifest=Path]");
+}
+
+int32 UValidationCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	TArray<FString> Levels;
+	if (!ParseLevels(ParamVals, Levels) || Levels.IsEmpty())
+	{
+		UE_LOG(LogValidationCommandlet, Error, TEXT("No Levels To Validate, Usage: %s"), *HelpUsage);
+		return ValidationCommandlet::ExitError;
+	}
+
+	uint32 WorkflowMask = ValidationMaskAll;
+	TOptional<EValidationStatus> FailStatus;
+	if (!ParseWorkflows(ParamVals, WorkflowMask) || !ParseFailOn(ParamVals, FailStatus))
+	{
+		UE_LOG(LogValidationCommandlet, Error, TEXT("Usage: %s"), *HelpUsage);
+		return ValidationCommandlet::ExitError;
+	}
+
+	const FString ReportDir = ParamVals.FindRef(TEXT("ReportDir"));
+	const int32 NumShards = FMath::Max(FCString::Atoi(*ParamVals.FindRef(TEXT("Shards"))), 1);
+	const bool bIncremental = Switches.Contains(TEXT("Incremental"));
+	const bool bCombined = bIncremental || NumShards > 1 || Switches.Contains(TEXT("Combined"));
+
+	// Combined reports default to the same location as the batch report api
+	const FString BatchReportDir = ReportDir.IsEmpty()
+		? FPaths::Combine(FPaths::ProjectDir(), TEXT("ValidationReports"), TEXT("Batch")) : ReportDir;
+	const FString BatchReportPath = FPaths::Combine(BatchReportDir, TEXT("Batch"));
+	if (bCombined)
+	{
+		IFileManager::Get().MakeDirectory(*BatchReportDir, true);
+	}
+
+	// Blueprint validations are discovered through the asset registry which is not populated up front in commandlets.
+	// A coordinator which only launches shards leaves this to its workers
+	if (bIncremental || NumShards == 1)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(true);
+	}
+
+	// Incremental runs only validate levels whose dependencies or settings changed since the manifest was written,
+	// reusing the previous rows for everything else
+	const FString ManifestPath = ParamVals.Contains(TEXT("Manifest"))
+		? ParamVals.FindChecked(TEXT("Manifest")) : FPaths::Combine(BatchReportDir, TEXT("Manifest.json"));
+	FValidationManifest Manifest;
+	TMap<FString, FValidationManifestLevel> ChangedLevels;
+	TArray<FValidationReportRow> ReusedRows;
+	TArray<FString> LevelsToValidate = Levels;
+	if (bIncremental)
+	{
+		Manifest.Load(ManifestPath);
+		const FString SettingsHash = FValidationManifest::ComputeSettingsHash(WorkflowMask);
+		if (SettingsHash != Manifest.GetSettingsHash())
+		{
+			UE_LOG(LogValidationCommandlet, Display, TEXT("Validation Settings Changed, Validating All Levels"));
+			Manifest.Reset(SettingsHash);
+		}
+
+		LevelsToValidate.Reset();
+		for (const FString& Level : Levels)
+		{
+			FValidationManifestLevel LevelEntry;
+			LevelEntry.ClosureHash = Manifest.ComputeLevelClosureHash(Level, LevelEntry.PackageHashes);
+
+			const FValidationManifestLevel* PreviousEntry = Manifest.FindLevel(Level);
+			if (PreviousEntry != nullptr && PreviousEntry->ClosureHash == LevelEntry.ClosureHash)
+			{
+				ReusedRows.Append(PreviousEntry->Rows);
+				continue;
+			}
+			LevelsToValidate.Add(Level);
+			ChangedLevels.Add(Level, MoveTemp(LevelEntry));
+		}
+
+		UE_LOG(LogValidationCommandlet, Display, TEXT("%d Of %d Levels Changed Since The Last Validation"),
+			LevelsToValidate.Num(), Levels.Num());
+	}
+
+	bool bErrors = false;
+	EValidationStatus WorstStatus = EValidationStatus::Pass;
+	if (NumShards > 1 && LevelsToValidate.Num() > 1)
+	{
+		const FString ShardRetries = ParamVals.FindRef(TEXT("ShardRetries"));
+		const int32 MaxRetries = ShardRetries.IsEmpty() ? 1 : FMath::Max(FCString::Atoi(*ShardRetries), 0);
+		const double ShardTimeout = FMath::Max(FCString::Atod(*ParamVals.FindRef(TEXT("ShardTimeout"))), 0.0);
+		const FString Workflows = ParamVals.Contains(TEXT("Workflows")) ? ParamVals.FindChecked(TEXT("Workflows")) : TEXT("All");
+		bErrors = !RunShards(LevelsToValidate, FMath::Min(NumShards, LevelsToValidate.Num()), MaxRetries, ShardTimeout,
+			Workflows, BatchReportPath, WorstStatus);
+	}
+	else if (bCombined)
+	{
+		// One report for every level, running the project validations only once. Project validations read content outside
+		// of any level closure, such as every nDisplay config and the default map, so incremental runs never reuse their
+		// rows and still run them here when no level changed
+		if (!UValidationBPLibrary::GenerateBatchValidationReportForWorkflows(LevelsToValidate, WorkflowMask, BatchReportPath, WorstStatus))
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Generate Validation Report For All Levels"));
+			bErrors = true;
+		}
+	}
+	else
+	{
+		for (const FString& Level : LevelsToValidate)
+		{
+			FString ReportPath;
+			if (!ReportDir.IsEmpty())
+			{
+				const FString LevelName = FPackageName::GetShortName(Level);
+				ReportPath = FPaths::Combine(ReportDir, LevelName, LevelName);
+				IFileManager::Get().MakeDirectory(*FPaths::GetPath(ReportPath), true);
+			}
+
+			EValidationStatus LevelStatus;
+			if (!UValidationBPLibrary::GenerateValidationReportForWorkflows(Level, WorkflowMask, ReportPath, LevelStatus))
+			{
+				UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Generate Validation Report For %s"), *Level);
+				bErrors = true;
+				continue;
+			}
+
+			const FString StatusName = StaticEnum<EValidationStatus>()->GetNameStringByValue(static_cast<int64>(LevelStatus));
+			UE_LOG(LogValidationCommandlet, Display, TEXT("%s: %s"), *Level, *StatusName);
+			WorstStatus = FMath::Min(WorstStatus, LevelStatus);
+		}
+	}
+
+	if (bIncremental && !UpdateIncrementalReport(Manifest, ManifestPath, MoveTemp(ChangedLevels), MoveTemp(ReusedRows),
+		Levels, BatchReportPath, WorstStatus))
+	{
+		bErrors = true;
+	}
+
+	if (bErrors)
+	{
+		return ValidationCommandlet::ExitError;
+	}
+
+	if (FailStatus.IsSet() && WorstStatus <= FailStatus.GetValue())
+	{
+		return ValidationCommandlet::ExitValidationFailed;
+	}
+	return ValidationCommandlet::ExitSuccess;
+}
+
+bool UValidationCommandlet::UpdateIncrementalReport(FValidationManifest& Manifest, const FString& ManifestPath,
+	TMap<FString, FValidationManifestLevel> ChangedLevels, TArray<FValidationReportRow> ReusedRows,
+	const TArray<FString>& Levels, const FString& BatchReportPath, EValidationStatus& OutWorstStatus)
+{
+	TArray<FValidationReportRow> NewRows;
+	const bool bReportRead = UValidationBPLibrary::ImportValidationReport(BatchReportPath, NewRows);
+	if (!bReportRead)
+	{
+		UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Read Validation Report %s"), *BatchReportPath);
+	}
+
+	// Only levels which actually produced rows are recorded, any which failed to load are validated again next run.
+	// Project rows are rerun every time so are not recorded
+	TMap<FString, TArray<FValidationReportRow>> NewLevelRows;
+	for (const FValidationReportRow& Row : NewRows)
+	{
+		if (!Row.Level.IsEmpty())
+		{
+			NewLevelRows.FindOrAdd(Row.Level).Add(Row);
+		}
+	}
+	for (TPair<FString, FValidationManifestLevel>& ChangedLevel : ChangedLevels)
+	{
+		if (TArray<FValidationReportRow>* LevelRows = NewLevelRows.Find(ChangedLevel.Key))
+		{
+			ChangedLevel.Value.Rows = MoveTemp(*LevelRows);
+			Manifest.SetLevel(ChangedLevel.Key, MoveTemp(ChangedLevel.Value));
+		}
+		else
+		{
+			Manifest.RemoveLevel(ChangedLevel.Key);
+		}
+	}
+
+	ReusedRows.Append(MoveTemp(NewRows));
+	UValidationReportDataTable* MergedReport = UValidationBPLibrary::MergeValidationReportRows(
+		MoveTemp(ReusedRows), Levels, OutWorstStatus);
+	if (!UValidationBPLibrary::ExportValidationReport(MergedReport, BatchReportPath))
+	{
+		UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Write Validation Report %s"), *BatchReportPath);
+		return false;
+	}
+
+	if (!Manifest.Save(ManifestPath))
+	{
+		UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Write Validation Manifest %s"), *ManifestPath);
+		return false;
+	}
+	return bReportRead;
+}
+
+bool UValidationCommandlet::RunShards(const TArray<FString>& Levels, const int32 NumShards, const int32 MaxRetries,
+	const double Timeout, const FString& Workflows, const FString& ReportPath, EValidationStatus& OutWorstStatus)
+{
+	using ValidationCommandlet::FValidationShard;
+
+	OutWorstStatus = EValidationStatus::Pass;
+	const FString OutputDir = FPaths::GetPath(ReportPath);
+
+	// Levels are dealt out in turn so that each shard gets a similar mix of the list
+	TArray<FValidationShard> Shards;
+	Shards.SetNum(NumShards);
+	for (int32 Index = 0; Index < Levels.Num(); ++Index)
+	{
+		Shards[Index % NumShards].Levels.Add(Levels[Index]);
+	}
+
+	bool bErrors = false;
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		FValidationShard& Shard = Shards[ShardIndex];
+		Shard.ShardDir = FPaths::ConvertRelativePathToFull(
+			FPaths::Combine(OutputDir, TEXT("Shards"), FString::Printf(TEXT("Shard%d"), ShardIndex)));
+		IFileManager::Get().MakeDirectory(*Shard.ShardDir, true);
+		if (!ValidationCommandlet::LaunchShard(Shard, Workflows))
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Launch Validation Shard %d"), ShardIndex);
+			bErrors = true;
+		}
+	}
+
+	// Workers only share the file system, so wait for each one to exit and check it left a report behind. A worker
+	// which reports errors would only fail again, whereas one which crashed, was killed or timed out is retried
+	for (bool bRunning = true; bRunning;)
+	{
+		bRunning = false;
+		for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			FValidationShard& Shard = Shards[ShardIndex];
+			if (!Shard.Process.IsValid())
+			{
+				continue;
+			}
+			bool bTimedOut = false;
+			if (FPlatformProcess::IsProcRunning(Shard.Process))
+			{
+				if (Timeout <= 0.0 || FPlatformTime::Seconds() - Shard.LaunchTime < Timeout)
+				{
+					bRunning = true;
+					continue;
+				}
+
+				// A worker stuck on a dialog or deadlocked would hold up the whole run, so it is killed and handled like a
+				// crash. Waiting for it to go ensures it can no longer write to the shard directory once relaunched
+				UE_LOG(LogValidationCommandlet, Warning, TEXT("Validation Shard %d Timed Out After %.0f Seconds"), ShardIndex, Timeout);
+				FPlatformProcess::TerminateProc(Shard.Process, true);
+				FPlatformProcess::WaitForProc(Shard.Process);
+				bTimedOut = true;
+			}
+
+			int32 ReturnCode = -1;
+			if (!bTimedOut)
+			{
+				FPlatformProcess::GetProcReturnCode(Shard.Process, &ReturnCode);
+			}
+			FPlatformProcess::CloseProc(Shard.Process);
+			Shard.Process.Reset();
+
+			const bool bReportWritten = FPaths::FileExists(FPaths::Combine(Shard.ShardDir, TEXT("Batch.json")));
+			if (ReturnCode == ValidationCommandlet::ExitSuccess && bReportWritten)
+			{
+				UE_LOG(LogValidationCommandlet, Display, TEXT("Validation Shard %d Complete"), ShardIndex);
+				Shard.bComplete = true;
+			}
+			else if (ReturnCode == ValidationCommandlet::ExitError)
+			{
+				// The levels the worker could not validate are missing from its report, so whatever it did validate is
+				// still merged and only the missing levels are reported below
+				UE_LOG(LogValidationCommandlet, Warning, TEXT("Validation Shard %d Reported Errors, See %s"), ShardIndex, *Shard.ShardDir);
+				Shard.bComplete = true;
+			}
+			else if (Shard.Attempts <= MaxRetries)
+			{
+				UE_LOG(LogValidationCommandlet, Warning, TEXT("Validation Shard %d Exited With %d, Retrying"), ShardIndex, ReturnCode);
+				if (ValidationCommandlet::LaunchShard(Shard, Workflows))
+				{
+					bRunning = true;
+				}
+				else
+				{
+					UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Launch Validation Shard %d"), ShardIndex);
+					bErrors = true;
+				}
+			}
+			else
+			{
+				UE_LOG(LogValidationCommandlet, Error, TEXT("Validation Shard %d Exited With %d After %d Attempts"),
+					ShardIndex, ReturnCode, Shard.Attempts);
+				bErrors = true;
+			}
+		}
+
+		if (bRunning)
+		{
+			FPlatformProcess::Sleep(0.5f);
+		}
+	}
+
+	// Merge whatever reports were written so a partial report is still available when a shard could not be validated
+	TArray<FValidationReportRow> Rows;
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		const FValidationShard& Shard = Shards[ShardIndex];
+		const FString ShardReportPath = FPaths::Combine(Shard.ShardDir, TEXT("Batch"));
+		if (!Shard.bComplete || !FPaths::FileExists(ShardReportPath + TEXT(".json")))
+		{
+			continue;
+		}
+
+		TArray<FValidationReportRow> ShardRows;
+		if (!UValidationBPLibrary::ImportValidationReport(ShardReportPath, ShardRows))
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Read Validation Shard %d Report %s"), ShardIndex, *ShardReportPath);
+			continue;
+		}
+		Rows.Append(MoveTemp(ShardRows));
+	}
+
+	// Only levels which actually produced rows were validated, the same as for incremental runs
+	TSet<FString> ReportedLevels;
+	for (const FValidationReportRow& Row : Rows)
+	{
+		ReportedLevels.Add(Row.Level);
+	}
+	for (const FString& Level : Levels)
+	{
+		if (!ReportedLevels.Contains(Level))
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("No Validation Report For %s"), *Level);
+			bErrors = true;
+		}
+	}
+
+	if (!Rows.IsEmpty())
+	{
+		UValidationReportDataTable* MergedReport = UValidationBPLibrary::MergeValidationReportRows(MoveTemp(Rows), Levels, OutWorstStatus);
+		if (MergedReport == nullptr || !UValidationBPLibrary::ExportValidationReport(MergedReport, ReportPath))
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Merge Validation Shard Reports"));
+			bErrors = true;
+		}
+	}
+
+	return !bErrors;
+}
+
+bool UValidationCommandlet::ParseLevels(const TMap<FString, FString>& ParamVals, TArray<FString>& OutLevels)
+{
+	if (const FString* LevelsArgument = ParamVals.Find(TEXT("Levels")))
+	{
+		OutLevels.Append(ValidationCommandlet::SplitArgument(*LevelsArgument));
+	}
+
+	if (const FString* LevelListArgument = ParamVals.Find(TEXT("LevelList")))
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, **LevelListArgument))
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("Unable To Read Level List %s"), **LevelListArgument);
+			return false;
+		}
+
+		for (FString& Line : Lines)
+		{
+			Line.TrimStartAndEndInline();
+			if (!Line.IsEmpty())
+			{
+				OutLevels.Add(Line);
+			}
+		}
+	}
+
+	return true;
+}
+
+bool UValidationCommandlet::ParseWorkflows(const TMap<FString, FString>& ParamVals, uint32& OutWorkflowMask)
+{
+	OutWorkflowMask = ValidationMaskAll;
+	const FString* WorkflowsArgument = ParamVals.Find(TEXT("Workflows"));
+	if (WorkflowsArgument == nullptr || WorkflowsArgument->Equals(TEXT("All"), ESearchCase::IgnoreCase))
+	{
+		return true;
+	}
+
+	OutWorkflowMask = 0;
+	const UEnum* WorkflowEnum = StaticEnum<EValidationWorkflow>();
+	for (const FString& WorkflowName : ValidationCommandlet::SplitArgument(*WorkflowsArgument))
+	{
+		const int64 Value = WorkflowEnum->GetValueByNameString(WorkflowName);
+		if (Value == INDEX_NONE)
+		{
+			UE_LOG(LogValidationCommandlet, Error, TEXT("Unknown Workflow %s"), *WorkflowName);
+			return false;
+		}
+		OutWorkflowMask |= ValidationWorkflowToMask(static_cast<EValidationWorkflow>(Value));
+	}
+
+	return OutWorkflowMask != 0;
+}
+
+bool UValidationCommandlet::ParseFailOn(const TMap<FString, FString>& ParamVals, TOptional<EValidationStatus>& OutFailStatus)
+{
+	const FString FailOn = ParamVals.Contains(TEXT("FailOn")) ? ParamVals.FindChecked(TEXT("FailOn")) : TEXT("Fail");
+	if (FailOn.Equals(TEXT("Fail"), ESearchCase::IgnoreCase))
+	{
+		OutFailStatus = EValidationStatus::Fail;
+		return true;
+	}
+	if (FailOn.Equals(TEXT("Warning"), ESearchCase::IgnoreCase))
+	{
+		OutFailStatus = EValidationStatus::Warning;
+		return true;
+	}
+	if (FailOn.Equals(TEXT("Never"), ESearchCase::IgnoreCase))
+	{
+		OutFailStatus.Reset();
+		return true;
+	}
+
+	UE_LOG(LogValidationCommandlet, Error, TEXT("Unknown FailOn Policy %s"), *FailOn);
+	return false;
+}
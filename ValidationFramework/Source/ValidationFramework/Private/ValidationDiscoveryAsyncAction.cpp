@@ -0,0 +1,76 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "ValidationDiscoveryAsyncAction.h"
+
+#include "ValidationRegistrySubsystem.h"
+
+
+UValidationDiscoveryAsyncAction* UValidationDiscoveryAsyncAction::GetAllValidationsAsync()
+{
+	return NewObject<UValidationDiscoveryAsyncAction>();
+}
+
+void UValidationDiscoveryAsyncAction::Activate()
+{
+	UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get();
+	if (Registry == nullptr)
+	{
+		HandleCompleted(TArray<UObject*>());
+		return;
+	}
+
+	// Editor utilities have no game instance to register with, so keep ourselves alive until discovery completes
+	AddToRoot();
+
+	if (Registry->IsDiscoveringValidations())
+	{
+		DiscoveredHandle = Registry->OnValidationsDiscovered.AddUObject(
+			this, &UValidationDiscoveryAsyncAction::HandleValidationsDiscovered);
+	}
+
+	TWeakObjectPtr<UValidationDiscoveryAsyncAction> WeakThis(this);
+	Registry->RequestAllValidations().Next([WeakThis](const TArray<UObject*>& Validations)
+	{
+		if (UValidationDiscoveryAsyncAction* This = WeakThis.Get())
+		{
+			This->HandleCompleted(Validations);
+		}
+	});
+}
+
+void UValidationDiscoveryAsyncAction::HandleValidationsDiscovered(const TArray<UObject*>& NewValidations)
+{
+	OnValidationsDiscovered.Broadcast(NewValidations);
+}
+
+void UValidationDiscoveryAsyncAction::HandleCompleted(const TArray<UObject*>& Validations)
+{
+	if (UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get())
+	{
+		Registry->OnValidationsDiscovered.Remove(DiscoveredHandle);
+	}
+	DiscoveredHandle.Reset();
+
+	OnCompleted.Broadcast(Validations);
+
+	if (IsRooted())
+	{
+		RemoveFromRoot();
+	}
+	SetReadyToDestroy();
+}
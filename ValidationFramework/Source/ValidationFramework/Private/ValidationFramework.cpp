@@ -34,15 +34,6 @@ limitations under the License.
 
 void FValidationFrameworkModule::StartupModule()
 {
-	// Add Netflix Style Sheet
-	const FString PluginContentDir = IPluginManager::Get().FindPlugin(TEXT("ValidationFramework"))->GetBaseDir();
-	StyleSet = MakeShareable(new FSlateStyleSet("NetflixStyleSheet"));
-	
-	StyleSet->SetContentRoot(PluginContentDir);
-	StyleSet->SetCoreContentRoot(PluginContentDir);
-		
-	FSlateStyleRegistry::RegisterSlateStyle(*StyleSet.Get());
-	
 	// Add & Register Project Settings
 	if(ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
 	{
@@ -52,6 +43,21 @@ void FValidationFrameworkModule::StartupModule()
 			GetMutableDefault<UVFProjectSettingsEditor>());
 	}
 
+	// Commandlets such as the validation commandlet run headless, so there is no UI to style or add menus too
+	if (IsRunningCommandlet())
+	{
+		return;
+	}
+
+	// Add Netflix Style Sheet
+	const FString PluginContentDir = IPluginManager::Get().FindPlugin(TEXT("ValidationFramework"))->GetBaseDir();
+	StyleSet = MakeShareable(new FSlateStyleSet("NetflixStyleSheet"));
+	
+	StyleSet->SetContentRoot(PluginContentDir);
+	StyleSet->SetCoreContentRoot(PluginContentDir);
+		
+	FSlateStyleRegistry::RegisterSlateStyle(*StyleSet.Get());
+
 	// Add And Register The Menu
 	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
 	const TSharedPtr<FExtender> MenuExtender = MakeShareable(new FExtender());
@@ -75,9 +81,12 @@ void FValidationFrameworkModule::ShutdownModule()
 	}
 
 	// Remove Style
-	FSlateStyleRegistry::UnRegisterSlateStyle(*StyleSet.Get());
-	ensure(StyleSet.IsUnique());
-	StyleSet.Reset();
+	if (StyleSet.IsValid())
+	{
+		FSlateStyleRegistry::UnRegisterSlateStyle(*StyleSet.Get());
+		ensure(StyleSet.IsUnique());
+		StyleSet.Reset();
+	}
 }
 
 void FValidationFrameworkModule::AddMenuEntry(FMenuBuilder& MenuBuilder) const
@@ -0,0 +1,93 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationICVFXConfigVisitor.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "ValidationBPLibrary.h"
+#include "DisplayClusterRootActor.h"
+#include "DisplayClusterConfigurationTypes.h"
+#include "Components/DisplayClusterICVFXCameraComponent.h"
+
+
+void FValidationICVFXConfigVisitor::Visit(const UWorld* World)
+{
+	TArray<AActor*> FoundActors;
+	UValidationBPLibrary::GetAllActorsOfClassForValidation(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+	for (const AActor* FoundActor : FoundActors)
+	{
+		VisitRootActor(*CastChecked<ADisplayClusterRootActor>(FoundActor));
+	}
+}
+
+void FValidationICVFXConfigVisitor::VisitRootActor(const ADisplayClusterRootActor& RootActor)
+{
+	OnRootActorBegin(RootActor);
+
+	if (const UDisplayClusterConfigurationData* ConfigData = RootActor.GetConfigData())
+	{
+		const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings = ConfigData->StageSettings;
+		OnStageSettings(RootActor, StageSettings);
+
+		const TArray<FDisplayClusterConfigurationOCIOProfile>& PerViewportOCIOProfiles = StageSettings.ViewportOCIO.PerViewportOCIOProfiles;
+		for (int32 ProfileIndex = 0; ProfileIndex < PerViewportOCIOProfiles.Num(); ++ProfileIndex)
+		{
+			OnPerViewportOCIOProfile(RootActor, ProfileIndex, PerViewportOCIOProfiles[ProfileIndex]);
+		}
+
+		for (int32 ProfileIndex = 0; ProfileIndex < StageSettings.PerViewportColorGrading.Num(); ++ProfileIndex)
+		{
+			OnPerViewportColorGrading(RootActor, ProfileIndex, StageSettings.PerViewportColorGrading[ProfileIndex]);
+		}
+
+		if (const UDisplayClusterConfigurationCluster* Cluster = ConfigData->Cluster)
+		{
+			for (const TPair<FString, TObjectPtr<UDisplayClusterConfigurationClusterNode>>& Node : Cluster->Nodes)
+			{
+				if (!Node.Value)
+				{
+					continue;
+				}
+
+				OnClusterNode(RootActor, Node.Key, *Node.Value);
+				for (const TPair<FString, TObjectPtr<UDisplayClusterConfigurationViewport>>& Viewport : Node.Value->Viewports)
+				{
+					if (Viewport.Value)
+					{
+						OnViewport(RootActor, Node.Key, Viewport.Key, *Viewport.Value);
+					}
+				}
+			}
+		}
+	}
+
+	TInlineComponentArray<UDisplayClusterICVFXCameraComponent*> IcvfxCameraComponents;
+	RootActor.GetComponents(IcvfxCameraComponents);
+	for (const UDisplayClusterICVFXCameraComponent* IcvfxCameraComponent : IcvfxCameraComponents)
+	{
+		const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings = IcvfxCameraComponent->CameraSettings;
+		OnICVFXCamera(RootActor, *IcvfxCameraComponent, CameraSettings);
+
+		const TArray<FDisplayClusterConfigurationOCIOProfile>& PerNodeOCIOProfiles = CameraSettings.CameraOCIO.PerNodeOCIOProfiles;
+		for (int32 ProfileIndex = 0; ProfileIndex < PerNodeOCIOProfiles.Num(); ++ProfileIndex)
+		{
+			OnPerNodeOCIOProfile(RootActor, *IcvfxCameraComponent, ProfileIndex, PerNodeOCIOProfiles[ProfileIndex]);
+		}
+	}
+
+	OnRootActorEnd(RootActor);
+}
+#endif
@@ -0,0 +1,335 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationManifest.h"
+
+#include "ValidationBase.h"
+#include "ValidationRegistrySubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Level.h"
+#include "ExternalPackageHelper.h"
+#include "Interfaces/IPluginManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackagePath.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace ValidationManifest
+{
+	/**
+	* Bumped whenever the manifest layout or what it hashes changes, so older manifests are discarded
+	*/
+	constexpr int32 ManifestVersion = 2;
+
+	FString HashFile(const FString& Filename)
+	{
+		return LexToString(FMD5Hash::HashFile(*Filename));
+	}
+
+	FString HashStrings(const TArray<FString>& Strings)
+	{
+		FSHA1 Sha;
+		for (const FString& String : Strings)
+		{
+			Sha.UpdateWithString(*String, String.Len());
+			Sha.Update(reinterpret_cast<const uint8*>(TEXT("\n")), sizeof(TCHAR));
+		}
+		Sha.Final();
+		FSHAHash Hash;
+		Sha.GetHash(Hash.Hash);
+		return Hash.ToString();
+	}
+
+	TArray<TSharedPtr<FJsonValue>> RowsToJson(const TArray<FValidationReportRow>& Rows)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonRows;
+		JsonRows.Reserve(Rows.Num());
+		for (const FValidationReportRow& Row : Rows)
+		{
+			JsonRows.Add(MakeShared<FJsonValueObject>(FJsonObjectConverter::UStructToJsonObject(Row)));
+		}
+		return JsonRows;
+	}
+
+	bool RowsFromJson(const TArray<TSharedPtr<FJsonValue>>& JsonRows, TArray<FValidationReportRow>& OutRows)
+	{
+		OutRows.Reset(JsonRows.Num());
+		for (const TSharedPtr<FJsonValue>& JsonRow : JsonRows)
+		{
+			const TSharedPtr<FJsonObject>* JsonObject = nullptr;
+			if (!JsonRow.IsValid() || !JsonRow->TryGetObject(JsonObject)
+				|| !FJsonObjectConverter::JsonObjectToUStruct(JsonObject->ToSharedRef(), &OutRows.AddDefaulted_GetRef()))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+bool FValidationManifest::Load(const FString& ManifestPath)
+{
+	Reset(FString());
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *ManifestPath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid()
+		|| Root->GetIntegerField(TEXT("Version")) != ValidationManifest::ManifestVersion)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* JsonLevels = nullptr;
+	if (!Root->TryGetObjectField(TEXT("Levels"), JsonLevels))
+	{
+		Reset(FString());
+		return false;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& JsonLevel : (*JsonLevels)->Values)
+	{
+		const TSharedPtr<FJsonObject>* JsonLevelObject = nullptr;
+		const TSharedPtr<FJsonObject>* JsonPackages = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* JsonRows = nullptr;
+		FValidationManifestLevel Level;
+		if (!JsonLevel.Value->TryGetObject(JsonLevelObject)
+			|| !(*JsonLevelObject)->TryGetStringField(TEXT("ClosureHash"), Level.ClosureHash)
+			|| !(*JsonLevelObject)->TryGetObjectField(TEXT("Packages"), JsonPackages)
+			|| !(*JsonLevelObject)->TryGetArrayField(TEXT("Rows"), JsonRows)
+			|| !ValidationManifest::RowsFromJson(*JsonRows, Level.Rows))
+		{
+			Reset(FString());
+			return false;
+		}
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& JsonPackage : (*JsonPackages)->Values)
+		{
+			Level.PackageHashes.Add(JsonPackage.Key, JsonPackage.Value->AsString());
+		}
+		Levels.Add(JsonLevel.Key, MoveTemp(Level));
+	}
+
+	SettingsHash = Root->GetStringField(TEXT("SettingsHash"));
+	return true;
+}
+
+bool FValidationManifest::Save(const FString& ManifestPath) const
+{
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), ValidationManifest::ManifestVersion);
+	Root->SetStringField(TEXT("SettingsHash"), SettingsHash);
+
+	const TSharedRef<FJsonObject> JsonLevels = MakeShared<FJsonObject>();
+	for (const TPair<FString, FValidationManifestLevel>& Level : Levels)
+	{
+		const TSharedRef<FJsonObject> JsonPackages = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Package : Level.Value.PackageHashes)
+		{
+			JsonPackages->SetStringField(Package.Key, Package.Value);
+		}
+
+		const TSharedRef<FJsonObject> JsonLevel = MakeShared<FJsonObject>();
+		JsonLevel->SetStringField(TEXT("ClosureHash"), Level.Value.ClosureHash);
+		JsonLevel->SetObjectField(TEXT("Packages"), JsonPackages);
+		JsonLevel->SetArrayField(TEXT("Rows"), ValidationManifest::RowsToJson(Level.Value.Rows));
+		JsonLevels->SetObjectField(Level.Key, JsonLevel);
+	}
+	Root->SetObjectField(TEXT("Levels"), JsonLevels);
+
+	FString Json;
+	return FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json))
+		&& FFileHelper::SaveStringToFile(Json, *ManifestPath);
+}
+
+FString FValidationManifest::ComputeSettingsHash(const uint32 WorkflowMask)
+{
+	TArray<FString> Settings;
+	Settings.Add(FString::Printf(TEXT("Manifest=%d"), ValidationManifest::ManifestVersion));
+	Settings.Add(TEXT("Engine=") + FEngineVersion::Current().ToString());
+	Settings.Add(FString::Printf(TEXT("Workflows=%u"), WorkflowMask));
+
+	if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("ValidationFramework")))
+	{
+		Settings.Add(FString::Printf(TEXT("Plugin=%s.%d"), *Plugin->GetDescriptor().VersionName, Plugin->GetDescriptor().Version));
+	}
+
+	// Code changes to a validation are picked up through the binary of the module it lives in, blueprint changes
+	// through the content of its package
+	TSet<FName> ValidationModules;
+	TArray<FString> ValidationEntries;
+	if (UValidationRegistrySubsystem* Registry = UValidationRegistrySubsystem::Get())
+	{
+		for (const UValidationBase* Validation : Registry->GetValidations(WorkflowMask, ValidationMaskAll))
+		{
+			const UClass* ValidationClass = Validation->GetClass();
+			const UPackage* ValidationPackage = ValidationClass->GetOutermost();
+			if (ValidationClass->HasAnyClassFlags(CLASS_Native))
+			{
+				ValidationModules.Add(FPackageName::GetShortFName(ValidationPackage->GetFName()));
+				ValidationEntries.Add(ValidationClass->GetPathName());
+				continue;
+			}
+
+			FString Filename;
+			FPackagePath PackagePath;
+			if (FPackagePath::TryFromPackageName(ValidationPackage->GetFName(), PackagePath)
+				&& FPackageName::DoesPackageExist(PackagePath, &PackagePath))
+			{
+				Filename = PackagePath.GetLocalFullPath();
+			}
+			ValidationEntries.Add(ValidationClass->GetPathName() + TEXT("=") + ValidationManifest::HashFile(Filename));
+		}
+	}
+	ValidationEntries.Sort();
+	Settings.Append(ValidationEntries);
+
+	TArray<FString> ModuleEntries;
+	for (const FName ModuleName : ValidationModules)
+	{
+		FModuleStatus ModuleStatus;
+		if (FModuleManager::Get().QueryModule(ModuleName, ModuleStatus))
+		{
+			ModuleEntries.Add(ModuleName.ToString() + TEXT("=") + ValidationManifest::HashFile(ModuleStatus.FilePath));
+		}
+	}
+	ModuleEntries.Sort();
+	Settings.Append(ModuleEntries);
+
+	// Project validations read their settings from the project config
+	TArray<FString> ConfigFiles;
+	IFileManager::Get().FindFiles(ConfigFiles, *FPaths::Combine(FPaths::ProjectConfigDir(), TEXT("*.ini")), true, false);
+	ConfigFiles.Sort();
+	for (const FString& ConfigFile : ConfigFiles)
+	{
+		Settings.Add(ConfigFile + TEXT("=") + ValidationManifest::HashFile(FPaths::Combine(FPaths::ProjectConfigDir(), ConfigFile)));
+	}
+
+	return ValidationManifest::HashStrings(Settings);
+}
+
+FString FValidationManifest::ComputeLevelClosureHash(const FString& LevelPath, TMap<FString, FString>& OutPackageHashes)
+{
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry")).Get();
+
+	TArray<FName> PendingPackages;
+	TSet<FName> VisitedPackages;
+	PendingPackages.Add(FName(*LevelPath));
+
+	// World partition levels keep their actors in external packages which the level package does not reference
+	TArray<FAssetData> ExternalAssets;
+	for (const FString& ExternalPath : { ULevel::GetExternalActorsPath(LevelPath), FExternalPackageHelper::GetExternalObjectsPath(LevelPath) })
+	{
+		AssetRegistry.GetAssetsByPath(FName(*ExternalPath), ExternalAssets, true);
+	}
+	for (const FAssetData& ExternalAsset : ExternalAssets)
+	{
+		PendingPackages.Add(ExternalAsset.PackageName);
+	}
+
+	TArray<FName> Dependencies;
+	while (!PendingPackages.IsEmpty())
+	{
+		const FName PackageName = PendingPackages.Pop(EAllowShrinking::No);
+		bool bAlreadyVisited = false;
+		VisitedPackages.Add(PackageName, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			continue;
+		}
+
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+		for (const FName Dependency : Dependencies)
+		{
+			// Script packages are code, which is covered by the settings hash
+			if (!VisitedPackages.Contains(Dependency) && !FPackageName::IsScriptPackage(Dependency.ToString()))
+			{
+				PendingPackages.Add(Dependency);
+			}
+		}
+	}
+
+	TArray<FString> ClosureEntries;
+	ClosureEntries.Reserve(VisitedPackages.Num());
+	OutPackageHashes.Reset();
+	for (const FName PackageName : VisitedPackages)
+	{
+		const FString& PackageHash = OutPackageHashes.Add(PackageName.ToString(), HashPackage(PackageName));
+		ClosureEntries.Add(PackageName.ToString() + TEXT("=") + PackageHash);
+	}
+	ClosureEntries.Sort();
+
+	return ValidationManifest::HashStrings(ClosureEntries);
+}
+
+void FValidationManifest::Reset(const FString& NewSettingsHash)
+{
+	SettingsHash = NewSettingsHash;
+	Levels.Reset();
+}
+
+FString FValidationManifest::HashPackage(const FName PackageName)
+{
+	if (const FString* CachedHash = PackageHashCache.Find(PackageName))
+	{
+		return *CachedHash;
+	}
+
+	FString PackageHash;
+	FPackagePath PackagePath;
+	if (!FPackagePath::TryFromPackageName(PackageName, PackagePath) || !FPackageName::DoesPackageExist(PackagePath, &PackagePath))
+	{
+		PackageHash = TEXT("Missing");
+	}
+	else
+	{
+		const FString Filename = PackagePath.GetLocalFullPath();
+		if (!FPaths::IsUnderDirectory(Filename, FPaths::ConvertRelativePathToFull(FPaths::ProjectDir())))
+		{
+			// Engine and engine plugin content only changes with the engine version
+			PackageHash = TEXT("Engine");
+		}
+		else
+		{
+			// Packages may split their exports and bulk data into files beside the package file
+			TArray<FString> FileHashes;
+			FileHashes.Add(ValidationManifest::HashFile(Filename));
+			for (const TCHAR* Extension : { TEXT(".uexp"), TEXT(".ubulk"), TEXT(".uptnl") })
+			{
+				const FString SidecarFilename = FPaths::ChangeExtension(Filename, Extension);
+				if (FPaths::FileExists(SidecarFilename))
+				{
+					FileHashes.Add(ValidationManifest::HashFile(SidecarFilename));
+				}
+			}
+			PackageHash = FileHashes.Num() == 1 ? FileHashes[0] : ValidationManifest::HashStrings(FileHashes);
+		}
+	}
+
+	PackageHashCache.Add(PackageName, PackageHash);
+	return PackageHash;
+}
@@ -0,0 +1,398 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationMeshAnalysis.h"
+
+#include "ValidationBPLibrary.h"
+#include "ValidationMeshAnalysisCache.h"
+#include "ValidationMeshExclusions.h"
+#include "VFProjectSettingsBase.h"
+#include "Algo/AllOf.h"
+#include "Async/ParallelFor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "StaticMeshResources.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "DisplayClusterRootActor.h"
+#endif
+
+
+namespace ValidationMeshAnalysis
+{
+	/**
+	* Copies a single uv channel out of the interleaved texcoord data of the render data, converting half precision uvs
+	* to float so the layout is analyzed the same way whichever precision the mesh was built with
+	* @param VertexBuffer - The vertex buffer holding CPU accessible uvs
+	* @param Channel - The uv channel to copy
+	* @param OutUVs - Receives the uv of every vertex in the channel
+	*/
+	void CopyChannelUVs(const FStaticMeshVertexBuffer& VertexBuffer, const int32 Channel, TArray<FVector2f>& OutUVs)
+	{
+		const uint32 NumVertices = VertexBuffer.GetNumVertices();
+		const uint32 NumChannels = VertexBuffer.GetNumTexCoords();
+		OutUVs.SetNumUninitialized(NumVertices);
+		if (VertexBuffer.GetUseFullPrecisionUVs())
+		{
+			const FVector2f* TexCoords = static_cast<const FVector2f*>(VertexBuffer.GetTexCoordData()) + Channel;
+			for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+			{
+				OutUVs[VertexIndex] = TexCoords[VertexIndex * NumChannels];
+			}
+		}
+		else
+		{
+			const FVector2DHalf* TexCoords = static_cast<const FVector2DHalf*>(VertexBuffer.GetTexCoordData()) + Channel;
+			for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+			{
+				OutUVs[VertexIndex] = TexCoords[VertexIndex * NumChannels];
+			}
+		}
+	}
+
+#if WITH_EDITORONLY_DATA
+	/**
+	* Only one source mesh description is loaded at a time across all of the analysis workers, so analyzing many huge
+	* meshes without CPU accessible render data never holds more than one of them in memory
+	*/
+	FCriticalSection MeshDescriptionLock;
+
+	/**
+	* Loads the mesh description of a LOD and reads everything AnalyzeMeshDescription needs from it, holding the
+	* MeshDescriptionLock only for as long as the description is loaded
+	* @param SourceModel - The source model of the LOD
+	* @param bAnalyzeUVs - Whether to compute the vertex and triangle counts and uv bounds, and copy out the layout uvs
+	* @param bMeasureHalfPrecisionError - Whether to measure the error of converting the uvs to half precision
+	* @param UVLayoutChannelMask - The uv channels to copy the uvs of for layout analysis, one bit per channel
+	* @param LODFacts - The facts of the LOD, receiving the facts which were computed
+	* @param OutIndices - Receives the vertex instance indices of every triangle
+	* @param OutLayoutUVs - Receives the uvs of each channel in the mask, the other channels are left empty
+	* @return Whether the uvs were read, and so the layouts can be analyzed
+	*/
+	bool ReadMeshDescription(const FStaticMeshSourceModel& SourceModel, const bool bAnalyzeUVs,
+		const bool bMeasureHalfPrecisionError, const uint32 UVLayoutChannelMask, FValidationMeshLODFacts& LODFacts,
+		TArray<uint32>& OutIndices, TArray<TArray<FVector2f>>& OutLayoutUVs)
+	{
+		FScopeLock Lock(&MeshDescriptionLock);
+
+		FMeshDescription MeshDescription;
+		if (!SourceModel.LoadMeshDescription(MeshDescription))
+		{
+			return false;
+		}
+
+		// The attribute arrays are only contiguous once any removed elements have been compacted away
+		if (MeshDescription.NeedsCompact())
+		{
+			FElementIDRemappings Remappings;
+			MeshDescription.Compact(Remappings);
+		}
+
+		const FStaticMeshConstAttributes Attributes(MeshDescription);
+		const TVertexInstanceAttributesConstRef<FVector2f> VertexInstanceUVs = Attributes.GetVertexInstanceUVs();
+		const int32 NumChannels = FMath::Min(VertexInstanceUVs.GetNumChannels(), static_cast<int32>(FValidationUVBounds::MaxChannels));
+
+		if (bMeasureHalfPrecisionError)
+		{
+			LODFacts.UVHalfPrecisionErrors.SetNumZeroed(NumChannels);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				const TArrayView<const FVector2f> ChannelUVs = VertexInstanceUVs.GetRawArray(Channel);
+				FValidationUVBounds::ComputeHalfPrecisionErrorFloat(ChannelUVs.GetData(), ChannelUVs.Num(), 1,
+					MakeArrayView(&LODFacts.UVHalfPrecisionErrors[Channel], 1));
+			}
+		}
+
+		if (!bAnalyzeUVs)
+		{
+			return false;
+		}
+
+		OutIndices.Reserve(MeshDescription.Triangles().Num() * 3);
+		for (const FTriangleID TriangleID : MeshDescription.Triangles().GetElementIDs())
+		{
+			for (const FVertexInstanceID VertexInstanceID : MeshDescription.GetTriangleVertexInstances(TriangleID))
+			{
+				OutIndices.Add(VertexInstanceID.GetValue());
+			}
+		}
+
+		LODFacts.NumVertices = MeshDescription.VertexInstances().Num();
+		LODFacts.NumTriangles = MeshDescription.Triangles().Num();
+		LODFacts.UVBounds.SetNum(NumChannels);
+		LODFacts.UVLayouts.SetNum(NumChannels);
+		OutLayoutUVs.SetNum(NumChannels);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			const TArrayView<const FVector2f> ChannelUVs = VertexInstanceUVs.GetRawArray(Channel);
+			FValidationUVBounds::ComputeFloat(ChannelUVs.GetData(), ChannelUVs.Num(), 1, MakeArrayView(&LODFacts.UVBounds[Channel], 1));
+			if ((UVLayoutChannelMask & (1u << Channel)) != 0)
+			{
+				OutLayoutUVs[Channel] = ChannelUVs;
+			}
+		}
+		LODFacts.bHasCPUUVs = true;
+		LODFacts.bUVsFromMeshDescription = true;
+		return true;
+	}
+
+	/**
+	* Reads the uvs of a LOD from the mesh description bulk data of its source model, for when the render data holds no
+	* CPU copy of them or only holds them in half precision. The description is loaded into a local which is freed once
+	* analyzed, rather than being cached on the mesh, and the uvs are read in place from its attribute arrays. Only the
+	* uvs of the requested layout channels are copied out, and their layouts analyzed once the description is released
+	* @param SourceModel - The source model of the LOD
+	* @param bAnalyzeUVs - Whether to compute the vertex and triangle counts, uv bounds and uv layouts
+	* @param bMeasureHalfPrecisionError - Whether to measure the error of converting the uvs to half precision
+	* @param UVLayoutChannelMask - The uv channels to analyze the layouts of, one bit per channel
+	* @param LODFacts - The facts of the LOD, receiving the facts which were computed
+	*/
+	void AnalyzeMeshDescription(const FStaticMeshSourceModel& SourceModel, const bool bAnalyzeUVs,
+		const bool bMeasureHalfPrecisionError, const uint32 UVLayoutChannelMask, FValidationMeshLODFacts& LODFacts)
+	{
+		TArray<uint32> Indices;
+		TArray<TArray<FVector2f>> LayoutUVs;
+		if (!ReadMeshDescription(SourceModel, bAnalyzeUVs, bMeasureHalfPrecisionError, UVLayoutChannelMask, LODFacts,
+			Indices, LayoutUVs))
+		{
+			return;
+		}
+
+		const FIndexArrayView IndexView(Indices.GetData(), Indices.Num(), true);
+		for (int32 Channel = 0; Channel < LayoutUVs.Num(); ++Channel)
+		{
+			if ((UVLayoutChannelMask & (1u << Channel)) != 0)
+			{
+				LODFacts.UVLayouts[Channel] = FValidationUVLayout::Analyze(LayoutUVs[Channel], IndexView);
+			}
+		}
+	}
+#endif
+}
+
+FValidationMeshAnalysis::FValidationMeshAnalysis(const UWorld* World, const uint32 InUVLayoutChannelMask)
+	: UVLayoutChannelMask(InUVLayoutChannelMask)
+{
+	check(IsInGameThread());
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	TArray<AActor*> FoundActors;
+	UValidationBPLibrary::GetAllActorsOfClassForValidation(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+
+	// Meshes are kept in the order they are first found so messages keep the order of the world
+	TArray<const UStaticMesh*> UniqueMeshes;
+	TArray<TArray<FString>> MeshReferences;
+	TMap<const UStaticMesh*, int32> MeshIndices;
+	const TSharedRef<const FValidationMeshExclusions> MeshExclusions = UValidationBPLibrary::GetNDisplayMeshExclusions();
+	constexpr int32 ExcludedMeshIndex = INDEX_NONE - 1;
+	for (const AActor* FoundActor : FoundActors)
+	{
+		TInlineComponentArray<UStaticMeshComponent*> StaticMeshComponents;
+		FoundActor->GetComponents(StaticMeshComponents);
+		for (const UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
+		{
+			const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+			if (StaticMesh == nullptr || MeshExclusions->IsComponentExcluded(StaticMeshComponent))
+			{
+				continue;
+			}
+
+			// Each unique mesh is only matched against the exclusions once, however many components use it
+			int32& MeshIndex = MeshIndices.FindOrAdd(StaticMesh, INDEX_NONE);
+			if (MeshIndex == INDEX_NONE)
+			{
+				if (MeshExclusions->IsMeshExcluded(StaticMesh))
+				{
+					MeshIndex = ExcludedMeshIndex;
+					continue;
+				}
+				MeshIndex = UniqueMeshes.Add(StaticMesh);
+				MeshReferences.AddDefaulted();
+			}
+			else if (MeshIndex == ExcludedMeshIndex)
+			{
+				continue;
+			}
+			MeshReferences[MeshIndex].Add(StaticMeshComponent->GetReadableName());
+		}
+	}
+
+	// Everything read from the meshes themselves is gathered here, so the workers only read plain buffers
+	const bool bMeasureHalfPrecisionError = ShouldMeasureHalfPrecisionError();
+	TArray<FValidationMeshAnalysisInput> Inputs;
+	Inputs.Reserve(UniqueMeshes.Num());
+	for (const UStaticMesh* StaticMesh : UniqueMeshes)
+	{
+		Inputs.Add(GatherMesh(StaticMesh, bMeasureHalfPrecisionError, UVLayoutChannelMask));
+	}
+
+	Meshes.SetNum(Inputs.Num());
+	ParallelFor(Inputs.Num(), [this, &Inputs](const int32 MeshIndex)
+	{
+		Meshes[MeshIndex] = AnalyzeMesh(Inputs[MeshIndex]);
+	});
+
+	for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+	{
+		Meshes[MeshIndex].ReferencingComponents = MoveTemp(MeshReferences[MeshIndex]);
+	}
+	FValidationMeshAnalysisCache::Get().Flush();
+#endif
+}
+
+FValidationMeshAnalysisInput FValidationMeshAnalysis::GatherMesh(const UStaticMesh* StaticMesh,
+	const bool bMeasureHalfPrecisionError, const uint32 UVLayoutChannelMask)
+{
+	check(IsInGameThread());
+
+	FValidationMeshAnalysisInput Input;
+	Input.PathName = StaticMesh->GetPathName();
+	Input.CacheKey = FValidationMeshAnalysisCache::GetCacheKey(StaticMesh, bMeasureHalfPrecisionError, UVLayoutChannelMask);
+	Input.RenderData = StaticMesh->GetRenderData();
+	Input.bMeasureHalfPrecisionError = bMeasureHalfPrecisionError;
+	Input.UVLayoutChannelMask = UVLayoutChannelMask;
+
+	const int32 NumLODs = StaticMesh->GetNumLODs();
+	Input.LODs.SetNum(NumLODs);
+	for (int32 LodIndex = 0; LodIndex < NumLODs; ++LodIndex)
+	{
+		FValidationMeshAnalysisInput::FLOD& LODInput = Input.LODs[LodIndex];
+		LODInput.NumUVChannels = StaticMesh->GetNumUVChannels(LodIndex);
+		if (LodIndex < StaticMesh->GetNumSourceModels())
+		{
+			const FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(LodIndex);
+			LODInput.bGenerateLightmapUVs = SourceModel.BuildSettings.bGenerateLightmapUVs;
+			LODInput.bUseFullPrecisionUVs = SourceModel.BuildSettings.bUseFullPrecisionUVs;
+#if WITH_EDITORONLY_DATA
+			LODInput.SourceModel = &SourceModel;
+#endif
+		}
+	}
+	return Input;
+}
+
+FValidationMeshFacts FValidationMeshAnalysis::AnalyzeMesh(const FValidationMeshAnalysisInput& Input)
+{
+	FValidationMeshFacts MeshFacts;
+	MeshFacts.PathName = Input.PathName;
+
+	FValidationMeshAnalysisCache& Cache = FValidationMeshAnalysisCache::Get();
+	if (!Input.CacheKey.IsEmpty() && Cache.Find(Input.CacheKey, MeshFacts.LODs))
+	{
+		return MeshFacts;
+	}
+
+	const bool bMeasureHalfPrecisionError = Input.bMeasureHalfPrecisionError;
+	const FStaticMeshRenderData* RenderData = Input.RenderData;
+	MeshFacts.LODs.SetNum(Input.LODs.Num());
+	for (int32 LodIndex = 0; LodIndex < Input.LODs.Num(); ++LodIndex)
+	{
+		const FValidationMeshAnalysisInput::FLOD& LODInput = Input.LODs[LodIndex];
+		FValidationMeshLODFacts& LODFacts = MeshFacts.LODs[LodIndex];
+		LODFacts.NumUVChannels = LODInput.NumUVChannels;
+		LODFacts.bGenerateLightmapUVs = LODInput.bGenerateLightmapUVs;
+		LODFacts.bUseFullPrecisionUVs = LODInput.bUseFullPrecisionUVs;
+
+		if (RenderData != nullptr && RenderData->LODResources.IsValidIndex(LodIndex))
+		{
+			const FStaticMeshLODResources& LODResource = RenderData->LODResources[LodIndex];
+			const FStaticMeshVertexBuffer& VertexBuffer = LODResource.VertexBuffers.StaticMeshVertexBuffer;
+			LODFacts.NumVertices = VertexBuffer.GetNumVertices();
+			LODFacts.bHasCPUUVs = FValidationUVBounds::Compute(VertexBuffer, LODFacts.UVBounds);
+			if (bMeasureHalfPrecisionError)
+			{
+				FValidationUVBounds::ComputeHalfPrecisionError(VertexBuffer, LODFacts.UVHalfPrecisionErrors);
+			}
+
+			const FIndexArrayView Indices = LODResource.IndexBuffer.GetArrayView();
+			LODFacts.NumTriangles = Indices.Num() / 3;
+			if (LODFacts.bHasCPUUVs && Input.UVLayoutChannelMask != 0)
+			{
+				TArray<FVector2f> ChannelUVs;
+				LODFacts.UVLayouts.SetNum(LODFacts.UVBounds.Num());
+				for (int32 Channel = 0; Channel < LODFacts.UVBounds.Num(); ++Channel)
+				{
+					if ((Input.UVLayoutChannelMask & (1u << Channel)) != 0)
+					{
+						ValidationMeshAnalysis::CopyChannelUVs(VertexBuffer, Channel, ChannelUVs);
+						LODFacts.UVLayouts[Channel] = FValidationUVLayout::Analyze(ChannelUVs, Indices);
+					}
+				}
+			}
+		}
+
+#if WITH_EDITORONLY_DATA
+		// Half precision render data can not say how much precision was lost, so that is measured against the source
+		const bool bMeasureFromSource = bMeasureHalfPrecisionError && LODFacts.UVHalfPrecisionErrors.IsEmpty();
+		if ((!LODFacts.bHasCPUUVs || bMeasureFromSource) && LODInput.SourceModel != nullptr)
+		{
+			ValidationMeshAnalysis::AnalyzeMeshDescription(*LODInput.SourceModel, !LODFacts.bHasCPUUVs,
+				bMeasureFromSource, Input.UVLayoutChannelMask, LODFacts);
+		}
+#endif
+	}
+
+	// Whether the uvs are CPU accessible is not part of the render data identity, so only complete analyses are kept
+	const bool bComplete = Algo::AllOf(MeshFacts.LODs, [](const FValidationMeshLODFacts& LODFacts) { return LODFacts.bHasCPUUVs; });
+	if (!Input.CacheKey.IsEmpty() && bComplete)
+	{
+		Cache.Add(Input.CacheKey, MeshFacts.LODs);
+	}
+	return MeshFacts;
+}
+
+bool FValidationMeshAnalysis::ShouldMeasureHalfPrecisionError()
+{
+	const UVFProjectSettingsBase* ProjectSettings = Cast<UVFProjectSettingsBase>(UValidationBPLibrary::GetValidationFrameworkProjectSettings());
+	return ProjectSettings != nullptr && ProjectSettings->bMeasureUVHalfPrecisionError;
+}
+
+FValidationResult FValidationMeshAnalysis::Validate(
+	TFunctionRef<EValidationStatus(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)> Check) const
+{
+	FValidationResult Result = FValidationResult(EValidationStatus::Pass, "Valid");
+	FString Message = "";
+
+	for (const FValidationMeshFacts& MeshFacts : Meshes)
+	{
+		FString MeshMessage;
+		for (int32 LodIndex = 0; LodIndex < MeshFacts.LODs.Num(); ++LodIndex)
+		{
+			FString LodMessage;
+			const EValidationStatus LodStatus = Check(MeshFacts, LodIndex, LodMessage);
+			if (LodStatus <= Result.Result)
+			{
+				Result.Result = LodStatus;
+				MeshMessage += LodMessage;
+			}
+		}
+
+		// Each mesh is only checked once however many components use it, so name all of them
+		if (!MeshMessage.IsEmpty())
+		{
+			Message += MeshMessage + "Used By " + FString::Join(MeshFacts.ReferencingComponents, TEXT(", ")) + "\n";
+		}
+	}
+
+	if (Result.Result != EValidationStatus::Pass)
+	{
+		Result.Message = "Requires Manual Fix\n" + Message;
+	}
+
+	return Result;
+}
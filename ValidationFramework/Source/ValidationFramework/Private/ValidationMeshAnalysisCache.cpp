@@ -0,0 +1,248 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationMeshAnalysisCache.h"
+
+#include "Engine/StaticMesh.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "StaticMeshResources.h"
+
+namespace ValidationMeshAnalysisCache
+{
+	/**
+	* Bumped whenever FValidationMeshLODFacts or the way it is computed changes, invalidating every cached analysis
+	*/
+	constexpr uint32 AnalysisVersion = 6;
+
+	constexpr uint32 FileMagic = 0x564d4143;
+
+	TAutoConsoleVariable<bool> CVarMeshAnalysisCache(
+		TEXT("Validation.MeshAnalysisCache"),
+		true,
+		TEXT("Whether nDisplay mesh analysis results are cached between runs, keyed by the mesh render data"));
+
+	TAutoConsoleVariable<int32> CVarMeshAnalysisCacheMaxEntries(
+		TEXT("Validation.MeshAnalysisCacheMaxEntries"),
+		20000,
+		TEXT("The most mesh analyses kept in the cache, the least recently used are evicted beyond this"));
+
+	TAutoConsoleVariable<int32> CVarMeshAnalysisCacheMaxAgeDays(
+		TEXT("Validation.MeshAnalysisCacheMaxAgeDays"),
+		30,
+		TEXT("Mesh analyses which have not been used for this many days are evicted from the cache"));
+}
+
+static FArchive& operator<<(FArchive& Ar, FValidationUVChannelBounds& Bounds)
+{
+	return Ar << Bounds.Min << Bounds.Max << Bounds.NumOutOfRange;
+}
+
+static FArchive& operator<<(FArchive& Ar, FValidationUVLayoutFacts& Layout)
+{
+	return Ar << Layout.NumIslands << Layout.NumFlippedTriangles << Layout.CoveredArea << Layout.OverlapArea;
+}
+
+static FArchive& operator<<(FArchive& Ar, FValidationMeshLODFacts& LODFacts)
+{
+	Ar << LODFacts.NumUVChannels << LODFacts.NumVertices << LODFacts.NumTriangles;
+	Ar << LODFacts.bHasCPUUVs << LODFacts.bUVsFromMeshDescription;
+	Ar << LODFacts.UVBounds << LODFacts.UVLayouts << LODFacts.UVHalfPrecisionErrors;
+	return Ar << LODFacts.bGenerateLightmapUVs << LODFacts.bUseFullPrecisionUVs;
+}
+
+static FArchive& operator<<(FArchive& Ar, FValidationMeshAnalysisCache::FEntry& Entry)
+{
+	return Ar << Entry.LODs << Entry.LastUsedTicks;
+}
+
+FValidationMeshAnalysisCache& FValidationMeshAnalysisCache::Get()
+{
+	static FValidationMeshAnalysisCache Cache;
+	return Cache;
+}
+
+FValidationMeshAnalysisCache::FValidationMeshAnalysisCache()
+{
+	// Every process writes its own file, so all of them are merged keeping the most recent use of each analysis
+	TArray<FString> Filenames;
+	IFileManager::Get().FindFiles(Filenames, *FPaths::Combine(GetCacheDirectory(), TEXT("MeshAnalysisCache*.bin")), true, false);
+	for (const FString& Filename : Filenames)
+	{
+		const FString CacheFilename = FPaths::Combine(GetCacheDirectory(), Filename);
+		const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*CacheFilename);
+		TArray<uint8> Data;
+		if (!FFileHelper::LoadFileToArray(Data, *CacheFilename, FILEREAD_Silent))
+		{
+			continue;
+		}
+
+		TMap<FString, FEntry> FileEntries;
+		FMemoryReader Reader(Data);
+		Serialize(Reader, FileEntries);
+		if (!Reader.IsError())
+		{
+			MergeEntries(Entries, MoveTemp(FileEntries));
+		}
+		LoadedFiles.Add(CacheFilename, TimeStamp);
+	}
+}
+
+FString FValidationMeshAnalysisCache::GetCacheKey(const UStaticMesh* StaticMesh, const bool bMeasureHalfPrecisionError,
+	const uint32 UVLayoutChannelMask)
+{
+#if WITH_EDITORONLY_DATA
+	const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+	if (ValidationMeshAnalysisCache::CVarMeshAnalysisCache.GetValueOnAnyThread() && RenderData != nullptr
+		&& !RenderData->DerivedDataKey.IsEmpty())
+	{
+		// Whether half precision errors were measured and which layouts were analyzed change the analysis, so are kept apart
+		return FString::Printf(TEXT("%u_%s%s_%x"), ValidationMeshAnalysisCache::AnalysisVersion, *RenderData->DerivedDataKey,
+			bMeasureHalfPrecisionError ? TEXT("_HalfPrecisionError") : TEXT(""), UVLayoutChannelMask);
+	}
+#endif
+	return FString();
+}
+
+bool FValidationMeshAnalysisCache::Find(const FString& CacheKey, TArray<FValidationMeshLODFacts>& OutLODs)
+{
+	FWriteScopeLock Lock(EntriesLock);
+	FEntry* Entry = Entries.Find(CacheKey);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+	OutLODs = Entry->LODs;
+
+	// Uses are only recorded to the day, so runs against unchanged meshes do not rewrite the cache every time
+	const int64 NowTicks = FDateTime::UtcNow().GetTicks();
+	if (NowTicks - Entry->LastUsedTicks > ETimespan::TicksPerDay)
+	{
+		Entry->LastUsedTicks = NowTicks;
+		bDirty = true;
+	}
+	return true;
+}
+
+void FValidationMeshAnalysisCache::Add(const FString& CacheKey, const TArray<FValidationMeshLODFacts>& LODs)
+{
+	FWriteScopeLock Lock(EntriesLock);
+	FEntry& Entry = Entries.Add(CacheKey);
+	Entry.LODs = LODs;
+	Entry.LastUsedTicks = FDateTime::UtcNow().GetTicks();
+	bDirty = true;
+}
+
+void FValidationMeshAnalysisCache::Flush()
+{
+	check(IsInGameThread());
+
+	TArray<uint8> Data;
+	{
+		FWriteScopeLock Lock(EntriesLock);
+		if (!bDirty)
+		{
+			return;
+		}
+		EvictEntries();
+		FMemoryWriter Writer(Data);
+		Serialize(Writer, Entries);
+		bDirty = false;
+	}
+
+	// Written beside the cache and moved over it so other processes sharing the project never read a partial file
+	const FString CacheFilename = FPaths::Combine(GetCacheDirectory(),
+		FString::Printf(TEXT("MeshAnalysisCache.%u.bin"), FPlatformProcess::GetCurrentProcessId()));
+	const FString TempFilename = CacheFilename + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Data, *TempFilename) || !IFileManager::Get().Move(*CacheFilename, *TempFilename, true, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Unable To Write Mesh Analysis Cache %s"), *CacheFilename);
+		IFileManager::Get().Delete(*TempFilename, false, true, true);
+		return;
+	}
+
+	// The files merged when the cache was loaded are now held in this file, unless another process has rewritten them
+	// since, in which case they are left for the next load to merge
+	for (const TPair<FString, FDateTime>& LoadedFile : LoadedFiles)
+	{
+		if (LoadedFile.Key != CacheFilename && IFileManager::Get().GetTimeStamp(*LoadedFile.Key) == LoadedFile.Value)
+		{
+			IFileManager::Get().Delete(*LoadedFile.Key, false, true, true);
+		}
+	}
+	LoadedFiles.Reset();
+}
+
+FString FValidationMeshAnalysisCache::GetCacheDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ValidationFramework"));
+}
+
+void FValidationMeshAnalysisCache::Serialize(FArchive& Ar, TMap<FString, FEntry>& InOutEntries)
+{
+	uint32 Magic = ValidationMeshAnalysisCache::FileMagic;
+	uint32 Version = ValidationMeshAnalysisCache::AnalysisVersion;
+	Ar << Magic << Version;
+	if (Magic != ValidationMeshAnalysisCache::FileMagic || Version != ValidationMeshAnalysisCache::AnalysisVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+	Ar << InOutEntries;
+}
+
+void FValidationMeshAnalysisCache::MergeEntries(TMap<FString, FEntry>& InOutEntries, TMap<FString, FEntry> OtherEntries)
+{
+	for (TPair<FString, FEntry>& OtherEntry : OtherEntries)
+	{
+		FEntry* Entry = InOutEntries.Find(OtherEntry.Key);
+		if (Entry == nullptr || Entry->LastUsedTicks < OtherEntry.Value.LastUsedTicks)
+		{
+			InOutEntries.Add(OtherEntry.Key, MoveTemp(OtherEntry.Value));
+		}
+	}
+}
+
+void FValidationMeshAnalysisCache::EvictEntries()
+{
+	const int64 MaxAgeTicks = ValidationMeshAnalysisCache::CVarMeshAnalysisCacheMaxAgeDays.GetValueOnAnyThread() * ETimespan::TicksPerDay;
+	const int64 NowTicks = FDateTime::UtcNow().GetTicks();
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (NowTicks - It.Value().LastUsedTicks > MaxAgeTicks)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const int32 MaxEntries = FMath::Max(ValidationMeshAnalysisCache::CVarMeshAnalysisCacheMaxEntries.GetValueOnAnyThread(), 0);
+	if (Entries.Num() > MaxEntries)
+	{
+		Entries.ValueSort([](const FEntry& A, const FEntry& B) { return A.LastUsedTicks > B.LastUsedTicks; });
+		int32 Index = 0;
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (Index++ >= MaxEntries)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+	Entries.Compact();
+}
@@ -0,0 +1,227 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationMeshAssetAudit.h"
+
+#include "ValidationBPLibrary.h"
+#include "ValidationMeshAnalysisCache.h"
+#include "ValidationMeshExclusions.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshCompiler.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "Blueprints/DisplayClusterBlueprint.h"
+#endif
+
+namespace ValidationMeshAssetAudit
+{
+	/**
+	* The most meshes which are loaded and analyzed together before they are released again
+	*/
+	constexpr int32 LoadBatchSize = 32;
+}
+
+
+bool FValidationMeshAssetTags::Read(const FAssetData& AssetData, FValidationMeshAssetTags& OutTags)
+{
+	if (!AssetData.GetTagValue(FName("LODs"), OutTags.NumLODs)
+		|| !AssetData.GetTagValue(FName("UVChannels"), OutTags.NumUVChannels)
+		|| !AssetData.GetTagValue(FName("Vertices"), OutTags.NumVertices)
+		|| !AssetData.GetTagValue(FName("Triangles"), OutTags.NumTriangles))
+	{
+		return false;
+	}
+
+	// Meshes saved without render data write zero for all of the LOD 0 counts, which says nothing about the mesh
+	return OutTags.NumLODs > 0 && OutTags.NumVertices > 0;
+}
+
+TArray<FAssetData> FValidationMeshAssetAudit::FindNDisplayMeshAssets(TMap<FName, TArray<FString>>& OutReferencers)
+{
+	TArray<FAssetData> MeshAssets;
+	OutReferencers.Reset();
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry")).Get();
+	TArray<FAssetData> ConfigAssets;
+	AssetRegistry.GetAssetsByClass(UDisplayClusterBlueprint::StaticClass()->GetClassPathName(), ConfigAssets, true);
+
+	const TSharedRef<const FValidationMeshExclusions> MeshExclusions = UValidationBPLibrary::GetNDisplayMeshExclusions();
+	TArray<FName> Dependencies;
+	TArray<FAssetData> DependencyAssets;
+	for (const FAssetData& ConfigAsset : ConfigAssets)
+	{
+		// The meshes of the config are on the components of the blueprint, so are direct dependencies of its package
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(ConfigAsset.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+		for (const FName Dependency : Dependencies)
+		{
+			DependencyAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(Dependency, DependencyAssets);
+			for (const FAssetData& DependencyAsset : DependencyAssets)
+			{
+				if (!DependencyAsset.IsInstanceOf(UStaticMesh::StaticClass())
+					|| MeshExclusions->IsMeshAssetExcluded(DependencyAsset))
+				{
+					continue;
+				}
+
+				TArray<FString>* Referencers = OutReferencers.Find(DependencyAsset.PackageName);
+				if (Referencers == nullptr)
+				{
+					Referencers = &OutReferencers.Add(DependencyAsset.PackageName);
+					MeshAssets.Add(DependencyAsset);
+				}
+				Referencers->Add(ConfigAsset.AssetName.ToString());
+			}
+		}
+	}
+#endif
+
+	return MeshAssets;
+}
+
+FValidationResult FValidationMeshAssetAudit::Validate(FTagCheck TagCheck,
+	TFunctionRef<EValidationStatus(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)> Check)
+{
+	FValidationResult Result = FValidationResult(EValidationStatus::Pass, "Valid");
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	// Waiting for the registry here would freeze the editor until discovery finishes, and a partial search could miss
+	// configs, so the audit asks to be run again instead
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry")).Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		Result.Result = EValidationStatus::Warning;
+		Result.Message = "The Asset Registry Is Still Discovering Assets, Run Again Once It Has Finished";
+		return Result;
+	}
+
+	TMap<FName, TArray<FString>> Referencers;
+	const TArray<FAssetData> MeshAssets = FindNDisplayMeshAssets(Referencers);
+
+	// Every mesh is either answered by its tags or loaded and analyzed, the results are combined in the order the
+	// meshes were found afterwards so the report does not depend on which meshes needed loading
+	TArray<EValidationStatus> TagStatuses;
+	TArray<FString> TagMessages;
+	TArray<int32> AnalysisIndices;
+	TArray<int32> MeshesToLoad;
+	TagStatuses.Init(EValidationStatus::Pass, MeshAssets.Num());
+	TagMessages.SetNum(MeshAssets.Num());
+	AnalysisIndices.Init(INDEX_NONE, MeshAssets.Num());
+	for (int32 MeshIndex = 0; MeshIndex < MeshAssets.Num(); ++MeshIndex)
+	{
+		const FAssetData& MeshAsset = MeshAssets[MeshIndex];
+		FValidationMeshAssetTags Tags;
+		if (!FValidationMeshAssetTags::Read(MeshAsset, Tags)
+			|| !TagCheck(Tags, MeshAsset.GetObjectPathString(), TagStatuses[MeshIndex], TagMessages[MeshIndex]))
+		{
+			MeshesToLoad.Add(MeshIndex);
+		}
+	}
+
+	// Meshes are loaded a batch at a time and the audit drops its references to them before the next batch, so it never
+	// keeps more than a batch of meshes alive. Garbage collection is left to the caller, other validations may be running
+	const bool bMeasureHalfPrecisionError = FValidationMeshAnalysis::ShouldMeasureHalfPrecisionError();
+	TArray<FValidationMeshFacts> LoadedFacts;
+	for (int32 BatchStart = 0; BatchStart < MeshesToLoad.Num(); BatchStart += ValidationMeshAssetAudit::LoadBatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + ValidationMeshAssetAudit::LoadBatchSize, MeshesToLoad.Num());
+		TArray<TStrongObjectPtr<UStaticMesh>> BatchMeshes;
+		TArray<UStaticMesh*> CompilingMeshes;
+		for (int32 LoadIndex = BatchStart; LoadIndex < BatchEnd; ++LoadIndex)
+		{
+			const int32 MeshIndex = MeshesToLoad[LoadIndex];
+			const FAssetData& MeshAsset = MeshAssets[MeshIndex];
+			UStaticMesh* StaticMesh = Cast<UStaticMesh>(MeshAsset.GetAsset());
+			if (StaticMesh == nullptr)
+			{
+				TagStatuses[MeshIndex] = EValidationStatus::Warning;
+				TagMessages[MeshIndex] = MeshAsset.GetObjectPathString() + " Could Not Be Loaded\n";
+				continue;
+			}
+			AnalysisIndices[MeshIndex] = LoadedFacts.Num() + BatchMeshes.Num();
+			BatchMeshes.Emplace(StaticMesh);
+			CompilingMeshes.Add(StaticMesh);
+		}
+
+		// Loaded meshes build their render data asynchronously, which has to be in place before they can be analyzed
+		FStaticMeshCompilingManager::Get().FinishCompilation(CompilingMeshes);
+
+		TArray<FValidationMeshAnalysisInput> Inputs;
+		Inputs.Reserve(BatchMeshes.Num());
+		for (const TStrongObjectPtr<UStaticMesh>& StaticMesh : BatchMeshes)
+		{
+			Inputs.Add(FValidationMeshAnalysis::GatherMesh(StaticMesh.Get(), bMeasureHalfPrecisionError));
+		}
+
+		const int32 FirstFact = LoadedFacts.AddDefaulted(Inputs.Num());
+		ParallelFor(Inputs.Num(), [&LoadedFacts, &Inputs, FirstFact](const int32 InputIndex)
+		{
+			LoadedFacts[FirstFact + InputIndex] = FValidationMeshAnalysis::AnalyzeMesh(Inputs[InputIndex]);
+		});
+
+		// Only the facts are kept, the meshes loaded just for the audit are released before the next batch is loaded
+		Inputs.Reset();
+		CompilingMeshes.Reset();
+		BatchMeshes.Reset();
+	}
+	FValidationMeshAnalysisCache::Get().Flush();
+
+	FString Message = "";
+	for (int32 MeshIndex = 0; MeshIndex < MeshAssets.Num(); ++MeshIndex)
+	{
+		FString MeshMessage;
+		if (AnalysisIndices[MeshIndex] == INDEX_NONE)
+		{
+			if (TagStatuses[MeshIndex] <= Result.Result)
+			{
+				Result.Result = TagStatuses[MeshIndex];
+				MeshMessage += TagMessages[MeshIndex];
+			}
+		}
+		else
+		{
+			const FValidationMeshFacts& MeshFacts = LoadedFacts[AnalysisIndices[MeshIndex]];
+			for (int32 LodIndex = 0; LodIndex < MeshFacts.LODs.Num(); ++LodIndex)
+			{
+				FString LodMessage;
+				const EValidationStatus LodStatus = Check(MeshFacts, LodIndex, LodMessage);
+				if (LodStatus <= Result.Result)
+				{
+					Result.Result = LodStatus;
+					MeshMessage += LodMessage;
+				}
+			}
+		}
+
+		if (!MeshMessage.IsEmpty())
+		{
+			Message += MeshMessage + "Used By " + FString::Join(Referencers.FindChecked(MeshAssets[MeshIndex].PackageName), TEXT(", ")) + "\n";
+		}
+	}
+
+	if (Result.Result != EValidationStatus::Pass)
+	{
+		Result.Message = "Requires Manual Fix\n" + Message;
+	}
+#endif
+
+	return Result;
+}
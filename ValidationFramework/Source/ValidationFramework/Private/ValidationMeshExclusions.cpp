@@ -0,0 +1,149 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationMeshExclusions.h"
+
+#include "VFProjectSettingsEditor.h"
+#include "AssetRegistry/AssetData.h"
+#include "Components/ActorComponent.h"
+#include "Engine/StaticMesh.h"
+
+namespace ValidationMeshExclusions
+{
+	/**
+	* The rules compiled from the project settings, shared by everything matching meshes outside of a validation run
+	*/
+	TSharedPtr<const FValidationMeshExclusions> ProjectSettingsExclusions;
+	FCriticalSection ProjectSettingsLock;
+}
+
+FValidationMeshExclusions::FValidationMeshExclusions(TConstArrayView<FString> PackagePathPrefixes,
+	TConstArrayView<FName> InMeshNames, TConstArrayView<FName> InComponentTags)
+{
+	MeshNames.Append(InMeshNames);
+	ComponentTags.Append(InComponentTags);
+	MeshNames.Remove(NAME_None);
+	ComponentTags.Remove(NAME_None);
+
+	PrefixEnds.Add(false);
+	for (const FString& Prefix : PackagePathPrefixes)
+	{
+		if (Prefix.IsEmpty())
+		{
+			continue;
+		}
+
+		int32 Node = 0;
+		for (const TCHAR Character : Prefix)
+		{
+			int32& Child = PrefixEdges.FindOrAdd(GetPrefixEdgeKey(Node, Character), INDEX_NONE);
+			if (Child == INDEX_NONE)
+			{
+				Child = PrefixEnds.Add(false);
+			}
+			Node = Child;
+		}
+		PrefixEnds[Node] = true;
+	}
+}
+
+TSharedRef<const FValidationMeshExclusions> FValidationMeshExclusions::CompileProjectSettings()
+{
+	FScopeLock Lock(&ValidationMeshExclusions::ProjectSettingsLock);
+	if (!ValidationMeshExclusions::ProjectSettingsExclusions.IsValid())
+	{
+		const UVFProjectSettingsEditor* ProjectSettings = GetDefault<UVFProjectSettingsEditor>();
+		ValidationMeshExclusions::ProjectSettingsExclusions = MakeShared<FValidationMeshExclusions>(
+			ProjectSettings->NDisplayMeshExclusionPathPrefixes,
+			ProjectSettings->NDisplayMeshExclusionNames,
+			ProjectSettings->NDisplayMeshExclusionComponentTags);
+	}
+	return ValidationMeshExclusions::ProjectSettingsExclusions.ToSharedRef();
+}
+
+void FValidationMeshExclusions::InvalidateProjectSettings()
+{
+	// Anyone still holding the previous rules keeps them alive until they are done with them
+	FScopeLock Lock(&ValidationMeshExclusions::ProjectSettingsLock);
+	ValidationMeshExclusions::ProjectSettingsExclusions.Reset();
+}
+
+bool FValidationMeshExclusions::IsMeshExcluded(const UStaticMesh* StaticMesh) const
+{
+	return IsMeshExcluded(StaticMesh->GetPackage()->GetFName(), StaticMesh->GetFName());
+}
+
+bool FValidationMeshExclusions::IsMeshAssetExcluded(const FAssetData& MeshAsset) const
+{
+	return IsMeshExcluded(MeshAsset.PackageName, MeshAsset.AssetName);
+}
+
+bool FValidationMeshExclusions::IsComponentExcluded(const UActorComponent* Component) const
+{
+	if (ComponentTags.IsEmpty())
+	{
+		return false;
+	}
+
+	for (const FName Tag : Component->ComponentTags)
+	{
+		if (ComponentTags.Contains(Tag))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FValidationMeshExclusions::IsMeshExcluded(const FName PackageName, const FName MeshName) const
+{
+	// Names compare ignoring case, as do the prefixes below
+	if (MeshNames.Contains(MeshName))
+	{
+		return true;
+	}
+
+	if (PrefixEdges.IsEmpty())
+	{
+		return false;
+	}
+
+	// Written into a stack buffer so walking the trie never allocates
+	TStringBuilder<FName::StringBufferSize> PackagePath;
+	PackageName.AppendString(PackagePath);
+
+	int32 Node = 0;
+	for (const TCHAR Character : FStringView(PackagePath))
+	{
+		const int32* Child = PrefixEdges.Find(GetPrefixEdgeKey(Node, Character));
+		if (Child == nullptr)
+		{
+			return false;
+		}
+
+		Node = *Child;
+		if (PrefixEnds[Node])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+uint64 FValidationMeshExclusions::GetPrefixEdgeKey(const int32 Node, const TCHAR Character)
+{
+	return static_cast<uint64>(Node) << 32 | static_cast<uint32>(FChar::ToLower(Character));
+}
@@ -0,0 +1,86 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationNDisplayNameIndex.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "DisplayClusterConfigurationTypes.h"
+#include "Algo/LevenshteinDistance.h"
+
+
+namespace ValidationNDisplayNameIndex
+{
+	template<typename TNameRange>
+	FString SuggestName(const FString& Name, const TNameRange& Names)
+	{
+		const FString LowerName = Name.ToLower();
+		FString Suggestion;
+		int32 BestDistance = FValidationNDisplayNameIndex::MaxTypoDistance + 1;
+		for (const FString& Candidate : Names)
+		{
+			// Names whose lengths differ by more than the allowed distance can never be close enough
+			if (FMath::Abs(Candidate.Len() - Name.Len()) >= BestDistance)
+			{
+				continue;
+			}
+
+			const int32 Distance = Algo::LevenshteinDistance(LowerName, Candidate.ToLower());
+			if (Distance < BestDistance)
+			{
+				BestDistance = Distance;
+				Suggestion = Candidate;
+			}
+		}
+		return Suggestion;
+	}
+}
+
+FValidationNDisplayNameIndex::FValidationNDisplayNameIndex(const UDisplayClusterConfigurationData& ConfigData)
+{
+	const UDisplayClusterConfigurationCluster* Cluster = ConfigData.Cluster;
+	if (Cluster == nullptr)
+	{
+		return;
+	}
+
+	Nodes.Reserve(Cluster->Nodes.Num());
+	for (const TPair<FString, TObjectPtr<UDisplayClusterConfigurationClusterNode>>& Node : Cluster->Nodes)
+	{
+		Nodes.Add(Node.Key);
+		if (Node.Value)
+		{
+			ViewportNodes.Reserve(ViewportNodes.Num() + Node.Value->Viewports.Num());
+			for (const TPair<FString, TObjectPtr<UDisplayClusterConfigurationViewport>>& Viewport : Node.Value->Viewports)
+			{
+				ViewportNodes.Add(Viewport.Key, Node.Key);
+			}
+		}
+	}
+
+	// Kept alongside the map so suggesting a viewport for each failing reference does not copy the names every time
+	ViewportNodes.GenerateKeyArray(Viewports);
+}
+
+FString FValidationNDisplayNameIndex::SuggestNode(const FString& NodeId) const
+{
+	return ValidationNDisplayNameIndex::SuggestName(NodeId, Nodes);
+}
+
+FString FValidationNDisplayNameIndex::SuggestViewport(const FString& ViewportId) const
+{
+	return ValidationNDisplayNameIndex::SuggestName(ViewportId, Viewports);
+}
+#endif
@@ -0,0 +1,241 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationOCIOEquivalence.h"
+
+#include "Async/ParallelFor.h"
+#include "ImageCore.h"
+#include "OpenColorIOConfiguration.h"
+#include "OpenColorIOWrapper.h"
+
+#include <atomic>
+
+
+namespace ValidationOCIOEquivalence
+{
+	/**
+	* Converts a linear Rec.709 color to CIELAB with a D65 white point, values outside of 0-1 are extrapolated rather
+	* than clamped so HDR and out of gamut differences are still measured. OCIO outputs are passed in as they are, even
+	* when display encoded such as sRGB or PQ, so the distances between them are numerical rather than perceptual
+	* @param Color - The linear Rec.709 color
+	* @return The L, a and b of the color
+	*/
+	FVector3f LinearRec709ToLab(const FLinearColor& Color)
+	{
+		constexpr float Delta = 6.f / 29.f;
+		auto LabF = [](const float T)
+		{
+			return T > Delta * Delta * Delta ? FMath::Pow(T, 1.f / 3.f) : T / (3.f * Delta * Delta) + 4.f / 29.f;
+		};
+
+		const float X = (0.4124f * Color.R + 0.3576f * Color.G + 0.1805f * Color.B) / 0.95047f;
+		const float Y = 0.2126f * Color.R + 0.7152f * Color.G + 0.0722f * Color.B;
+		const float Z = (0.0193f * Color.R + 0.1192f * Color.G + 0.9505f * Color.B) / 1.08883f;
+
+		const float FX = LabF(X);
+		const float FY = LabF(Y);
+		const float FZ = LabF(Z);
+		return FVector3f(116.f * FY - 16.f, 500.f * (FX - FY), 200.f * (FY - FZ));
+	}
+
+	bool IsFinite(const FLinearColor& Color)
+	{
+		return FMath::IsFinite(Color.R) && FMath::IsFinite(Color.G) && FMath::IsFinite(Color.B);
+	}
+
+	/**
+	* The difference measured over a single batch of samples, reduced into the overall difference
+	*/
+	struct FBatchDifference
+	{
+		float MaxDeltaE = 0.f;
+		double SumDeltaE = 0.0;
+		int32 WorstIndex = INDEX_NONE;
+		int32 NumFiniteSamples = 0;
+		int32 NumNonFiniteSamples = 0;
+	};
+}
+
+TConstArrayView<FLinearColor> FValidationOCIOEquivalence::GetSamples()
+{
+	static const TArray<FLinearColor> Samples = []()
+	{
+		TArray<FLinearColor> Colors;
+		Colors.Reserve(LatticeSize * LatticeSize * LatticeSize + HDRRampSize * 4);
+
+		constexpr float LatticeStep = 1.f / (LatticeSize - 1);
+		for (int32 B = 0; B < LatticeSize; B++)
+		{
+			for (int32 G = 0; G < LatticeSize; G++)
+			{
+				for (int32 R = 0; R < LatticeSize; R++)
+				{
+					Colors.Emplace(R * LatticeStep, G * LatticeStep, B * LatticeStep, 1.f);
+				}
+			}
+		}
+
+		// Logarithmic ramps from 2^-10 to 2^7 cover the shadows through to the highlights of scene linear HDR content
+		constexpr float MinStop = -10.f;
+		constexpr float MaxStop = 7.f;
+		const FLinearColor RampColors[] = {FLinearColor::White, FLinearColor::Red, FLinearColor::Green, FLinearColor::Blue};
+		for (const FLinearColor& RampColor : RampColors)
+		{
+			for (int32 Step = 0; Step < HDRRampSize; Step++)
+			{
+				const float Value = FMath::Pow(2.f, FMath::Lerp(MinStop, MaxStop, Step / float(HDRRampSize - 1)));
+				FLinearColor Color = RampColor * Value;
+				Color.A = 1.f;
+				Colors.Add(Color);
+			}
+		}
+		return Colors;
+	}();
+
+	return Samples;
+}
+
+bool FValidationOCIOEquivalence::EvaluateSamples(const FOpenColorIOColorConversionSettings& Settings, TArray<FLinearColor>& OutColors)
+{
+	OutColors = GetSamples();
+	if (!TransformColors(Settings, OutColors))
+	{
+		OutColors.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FValidationOCIOEquivalence::TransformColors(const FOpenColorIOColorConversionSettings& Settings, TArrayView<FLinearColor> InOutColors)
+{
+	const UOpenColorIOConfiguration* Configuration = Settings.ConfigurationSource.Get();
+	const FOpenColorIOWrapperConfig* ConfigWrapper = Configuration ? Configuration->GetConfigWrapper() : nullptr;
+	if (ConfigWrapper == nullptr)
+	{
+		return false;
+	}
+
+	TUniquePtr<FOpenColorIOWrapperProcessor> Processor;
+	if (Settings.DestinationColorSpace.ColorSpaceName.IsEmpty())
+	{
+		Processor = MakeUnique<FOpenColorIOWrapperProcessor>(
+			ConfigWrapper,
+			Settings.SourceColorSpace.ColorSpaceName,
+			Settings.DestinationDisplayView.Display,
+			Settings.DestinationDisplayView.View,
+			Settings.DisplayViewDirection == EOpenColorIOViewTransformDirection::Inverse);
+	}
+	else
+	{
+		Processor = MakeUnique<FOpenColorIOWrapperProcessor>(
+			ConfigWrapper,
+			Settings.SourceColorSpace.ColorSpaceName,
+			Settings.DestinationColorSpace.ColorSpaceName);
+	}
+
+	if (!Processor->IsValid())
+	{
+		return false;
+	}
+
+	// The CPU processor is safe to share between threads, each batch transforms its own slice of the packed buffer
+	std::atomic<bool> bTransformed = true;
+	const int32 NumBatches = FMath::DivideAndRoundUp(InOutColors.Num(), BatchSize);
+	ParallelFor(NumBatches, [&InOutColors, &Processor, &bTransformed](const int32 BatchIndex)
+	{
+		const int32 Start = BatchIndex * BatchSize;
+		const int32 Count = FMath::Min(BatchSize, InOutColors.Num() - Start);
+		const FImageView Batch(InOutColors.GetData() + Start, Count, 1, EGammaSpace::Linear);
+		if (!Processor->TransformImage(Batch))
+		{
+			bTransformed = false;
+		}
+	});
+	return bTransformed;
+}
+
+FValidationOCIOColorDifference FValidationOCIOEquivalence::CompareSamples(
+	TConstArrayView<FLinearColor> ReferenceColors, TConstArrayView<FLinearColor> OtherColors)
+{
+	check(ReferenceColors.Num() == OtherColors.Num());
+
+	const int32 NumBatches = FMath::DivideAndRoundUp(ReferenceColors.Num(), BatchSize);
+	TArray<ValidationOCIOEquivalence::FBatchDifference> BatchDifferences;
+	BatchDifferences.SetNum(NumBatches);
+
+	ParallelFor(NumBatches, [&ReferenceColors, &OtherColors, &BatchDifferences](const int32 BatchIndex)
+	{
+		ValidationOCIOEquivalence::FBatchDifference& BatchDifference = BatchDifferences[BatchIndex];
+		const int32 Start = BatchIndex * BatchSize;
+		const int32 End = FMath::Min(Start + BatchSize, ReferenceColors.Num());
+		for (int32 Index = Start; Index < End; Index++)
+		{
+			const FLinearColor& ReferenceColor = ReferenceColors[Index];
+			const FLinearColor& OtherColor = OtherColors[Index];
+			const bool bReferenceFinite = ValidationOCIOEquivalence::IsFinite(ReferenceColor);
+			const bool bOtherFinite = ValidationOCIOEquivalence::IsFinite(OtherColor);
+			if (!bReferenceFinite || !bOtherFinite)
+			{
+				if (bReferenceFinite != bOtherFinite)
+				{
+					BatchDifference.NumNonFiniteSamples++;
+				}
+				continue;
+			}
+
+			const float DeltaE = FVector3f::Distance(
+				ValidationOCIOEquivalence::LinearRec709ToLab(ReferenceColor),
+				ValidationOCIOEquivalence::LinearRec709ToLab(OtherColor));
+			BatchDifference.SumDeltaE += DeltaE;
+			BatchDifference.NumFiniteSamples++;
+			if (DeltaE > BatchDifference.MaxDeltaE || BatchDifference.WorstIndex == INDEX_NONE)
+			{
+				BatchDifference.MaxDeltaE = DeltaE;
+				BatchDifference.WorstIndex = Index;
+			}
+		}
+	});
+
+	FValidationOCIOColorDifference Difference;
+	Difference.bEvaluated = true;
+
+	double SumDeltaE = 0.0;
+	int32 NumFiniteSamples = 0;
+	int32 WorstIndex = INDEX_NONE;
+	for (const ValidationOCIOEquivalence::FBatchDifference& BatchDifference : BatchDifferences)
+	{
+		SumDeltaE += BatchDifference.SumDeltaE;
+		NumFiniteSamples += BatchDifference.NumFiniteSamples;
+		Difference.NumNonFiniteSamples += BatchDifference.NumNonFiniteSamples;
+		if (BatchDifference.WorstIndex != INDEX_NONE && (WorstIndex == INDEX_NONE || BatchDifference.MaxDeltaE > Difference.MaxDeltaE))
+		{
+			Difference.MaxDeltaE = BatchDifference.MaxDeltaE;
+			WorstIndex = BatchDifference.WorstIndex;
+		}
+	}
+
+	if (NumFiniteSamples)
+	{
+		Difference.MeanDeltaE = float(SumDeltaE / NumFiniteSamples);
+	}
+
+	const TConstArrayView<FLinearColor> Samples = GetSamples();
+	if (Samples.IsValidIndex(WorstIndex))
+	{
+		Difference.WorstSample = Samples[WorstIndex];
+	}
+	return Difference;
+}
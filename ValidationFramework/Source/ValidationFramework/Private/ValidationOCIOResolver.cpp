@@ -0,0 +1,128 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationOCIOResolver.h"
+
+#include "OpenColorIOConfiguration.h"
+#include "ValidationBPLibrary.h"
+#include "VFProjectSettingsBase.h"
+
+
+FValidationOCIOResolver::FConversionKey::FConversionKey(const FOpenColorIOColorConversionSettings& Settings)
+	: Configuration(Settings.ConfigurationSource.Get())
+	, SourceColorSpace(Settings.SourceColorSpace.ColorSpaceName)
+	, DestinationColorSpace(Settings.DestinationColorSpace.ColorSpaceName)
+	, Display(Settings.DestinationDisplayView.Display)
+	, View(Settings.DestinationDisplayView.View)
+	, bInverseDisplayView(Settings.DisplayViewDirection == EOpenColorIOViewTransformDirection::Inverse)
+{
+}
+
+FValidationOCIOResolution FValidationOCIOResolver::Resolve(const FOpenColorIOColorConversionSettings& Settings)
+{
+	check(IsInGameThread());
+
+	FConversionKey Key(Settings);
+	if (const FValidationOCIOResolution* Resolution = Resolutions.Find(Key))
+	{
+		return *Resolution;
+	}
+
+	FValidationOCIOResolution Resolution;
+	Resolution.bIsValid = Settings.IsValid();
+	Resolution.Id = Resolutions.Num();
+	Resolution.ConfigurationPath = FSoftObjectPath(Settings.ConfigurationSource.Get());
+	Resolutions.Add(MoveTemp(Key), Resolution);
+	return Resolution;
+}
+
+void FValidationOCIOResolver::ReadProjectSettings()
+{
+	if (bProjectSettingsRead)
+	{
+		return;
+	}
+
+	bProjectSettingsRead = true;
+	if (const UVFProjectSettingsBase* Settings = Cast<UVFProjectSettingsBase>(UValidationBPLibrary::GetValidationFrameworkProjectSettings()))
+	{
+		ProjectSettings = Settings->ProjectOpenIOColorConfig;
+		if (Settings->bCompareOCIOTransformsNumerically)
+		{
+			MaxNumericalDeltaE = Settings->MaxOCIODeltaE;
+		}
+	}
+}
+
+const FOpenColorIOColorConversionSettings* FValidationOCIOResolver::GetProjectSettings()
+{
+	ReadProjectSettings();
+	return ProjectSettings.GetPtrOrNull();
+}
+
+TOptional<float> FValidationOCIOResolver::GetMaxNumericalDeltaE()
+{
+	ReadProjectSettings();
+	return MaxNumericalDeltaE;
+}
+
+FValidationOCIOResolution FValidationOCIOResolver::ResolveProjectSettings()
+{
+	const FOpenColorIOColorConversionSettings* Settings = GetProjectSettings();
+	return Settings ? Resolve(*Settings) : FValidationOCIOResolution();
+}
+
+const TArray<FLinearColor>& FValidationOCIOResolver::EvaluateSamples(const FOpenColorIOColorConversionSettings& Settings, const int32 ResolutionId)
+{
+	if (const TArray<FLinearColor>* Colors = EvaluatedSamples.Find(ResolutionId))
+	{
+		return *Colors;
+	}
+
+	TArray<FLinearColor>& Colors = EvaluatedSamples.Add(ResolutionId);
+	if (!FValidationOCIOEquivalence::EvaluateSamples(Settings, Colors))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Unable to evaluate OCIO conversion %s on the CPU"), *Settings.ToString());
+	}
+	return Colors;
+}
+
+FValidationOCIOColorDifference FValidationOCIOResolver::CompareNumerically(
+	const FOpenColorIOColorConversionSettings& ReferenceSettings,
+	const FOpenColorIOColorConversionSettings& OtherSettings)
+{
+	const FValidationOCIOResolution ReferenceResolution = Resolve(ReferenceSettings);
+	const FValidationOCIOResolution OtherResolution = Resolve(OtherSettings);
+	const TPair<int32, int32> Pair(ReferenceResolution.Id, OtherResolution.Id);
+	if (const FValidationOCIOColorDifference* Difference = Differences.Find(Pair))
+	{
+		return *Difference;
+	}
+
+	// Evaluate both before looking either up, as adding to the map may move the samples evaluated earlier
+	EvaluateSamples(ReferenceSettings, ReferenceResolution.Id);
+	EvaluateSamples(OtherSettings, OtherResolution.Id);
+	const TArray<FLinearColor>& ReferenceColors = EvaluatedSamples.FindChecked(ReferenceResolution.Id);
+	const TArray<FLinearColor>& OtherColors = EvaluatedSamples.FindChecked(OtherResolution.Id);
+
+	FValidationOCIOColorDifference Difference;
+	if (ReferenceColors.Num() && ReferenceColors.Num() == OtherColors.Num())
+	{
+		Difference = FValidationOCIOEquivalence::CompareSamples(ReferenceColors, OtherColors);
+	}
+	Differences.Add(Pair, Difference);
+	return Difference;
+}
@@ -0,0 +1,666 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "ValidationRegistrySubsystem.h"
+
+#include "Editor.h"
+#include "ValidationBase.h"
+#include "VFProjectSettingsEditor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/UObjectIterator.h"
+
+
+void UValidationRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry")).Get();
+	AssetRegistry.OnAssetAdded().AddUObject(this, &UValidationRegistrySubsystem::OnAssetAdded);
+	AssetRegistry.OnAssetRemoved().AddUObject(this, &UValidationRegistrySubsystem::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddUObject(this, &UValidationRegistrySubsystem::OnAssetRenamed);
+	AssetRegistry.OnFilesLoaded().AddUObject(this, &UValidationRegistrySubsystem::OnFilesLoaded);
+
+	// Whilst the asset registry is still discovering the project, ask it to look at the validation content first so
+	// validations become available as early as possible without having to block on a synchronous scan
+	ContentPaths = GetValidationContentPaths();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		for (const FString& ContentPath : ContentPaths)
+		{
+			AssetRegistry.PrioritizeSearchPath(ContentPath + TEXT("/"));
+		}
+	}
+
+	// New modules or hot reloads can bring new native validation classes into existence
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddUObject(
+		this, &UValidationRegistrySubsystem::OnModulesChanged);
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddUObject(
+		this, &UValidationRegistrySubsystem::OnReloadComplete);
+
+	// Recompiling a blueprint re-instances its generated class, so the cached default object is no longer the live one
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddUObject(
+			this, &UValidationRegistrySubsystem::OnBlueprintCompiled);
+	}
+}
+
+void UValidationRegistrySubsystem::Deinitialize()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(FName("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().RemoveAll(this);
+		AssetRegistry.OnAssetRemoved().RemoveAll(this);
+		AssetRegistry.OnAssetRenamed().RemoveAll(this);
+		AssetRegistry.OnFilesLoaded().RemoveAll(this);
+	}
+
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	// Never leave callers waiting on a future which will not be fulfilled
+	for (TPromise<TArray<UObject*>>& Promise : PendingRequests)
+	{
+		Promise.SetValue(TArray<UObject*>());
+	}
+	PendingRequests.Reset();
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : BlueprintClassHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	BlueprintClassHandles.Reset();
+
+	DiscoveredBlueprintClassPaths.Reset();
+	CodeValidations.Reset();
+	BlueprintValidations.Reset();
+	BlueprintValidationClasses.Reset();
+	ValidationIndex.Reset();
+	ValidationQueryCache.Reset();
+
+	Super::Deinitialize();
+}
+
+UValidationRegistrySubsystem* UValidationRegistrySubsystem::Get()
+{
+	return GEditor ? GEditor->GetEditorSubsystem<UValidationRegistrySubsystem>() : nullptr;
+}
+
+TArray<UObject*> UValidationRegistrySubsystem::GetAllValidations()
+{
+	TArray<UObject*> ValidationObjects = GetCodeValidations();
+	ValidationObjects += GetBlueprintValidations();
+	return ValidationObjects;
+}
+
+TArray<UObject*> UValidationRegistrySubsystem::GetCodeValidations()
+{
+	if (bCodeValidationsDirty)
+	{
+		RebuildCodeValidations();
+	}
+	return TArray<UObject*>(CodeValidations);
+}
+
+TArray<UObject*> UValidationRegistrySubsystem::GetBlueprintValidations()
+{
+	UpdateBlueprintValidations();
+	return TArray<UObject*>(BlueprintValidations);
+}
+
+const TArray<UValidationBase*>& UValidationRegistrySubsystem::GetValidations(const uint32 WorkflowMask, const uint32 ScopeMask)
+{
+	if (bCodeValidationsDirty)
+	{
+		RebuildCodeValidations();
+	}
+	UpdateBlueprintValidations();
+	if (bValidationIndexDirty)
+	{
+		RebuildValidationIndex();
+	}
+
+	const uint64 QueryKey = (static_cast<uint64>(ScopeMask) << 32) | WorkflowMask;
+	if (const TUniquePtr<TArray<UValidationBase*>>* CachedQuery = ValidationQueryCache.Find(QueryKey))
+	{
+		return **CachedQuery;
+	}
+
+	TArray<UValidationBase*>& Validations = *ValidationQueryCache.Add(QueryKey, MakeUnique<TArray<UValidationBase*>>());
+	for (const FValidationIndexEntry& Entry : ValidationIndex)
+	{
+		if ((Entry.WorkflowMask & WorkflowMask) != 0 && (Entry.ScopeMask & ScopeMask) != 0)
+		{
+			Validations.Add(Entry.Validation);
+		}
+	}
+	return Validations;
+}
+
+TFuture<TArray<UObject*>> UValidationRegistrySubsystem::RequestAllValidations()
+{
+	if (!IsDiscoveringValidations())
+	{
+		TPromise<TArray<UObject*>> Promise;
+		Promise.SetValue(GetAllValidations());
+		return Promise.GetFuture();
+	}
+
+	return PendingRequests.Emplace_GetRef().GetFuture();
+}
+
+bool UValidationRegistrySubsystem::IsDiscoveringValidations() const
+{
+	const FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(FName("AssetRegistry"));
+	return AssetRegistryModule != nullptr && AssetRegistryModule->Get().IsLoadingAssets();
+}
+
+void UValidationRegistrySubsystem::InvalidateRegistry()
+{
+	bCodeValidationsDirty = true;
+	bBlueprintValidationsDirty = true;
+}
+
+void UValidationRegistrySubsystem::RebuildCodeValidations()
+{
+	CodeValidations.Reset();
+	for(TObjectIterator< UClass > ClassIt; ClassIt; ++ClassIt)
+	{
+		UClass* Class = *ClassIt;
+
+		// Only interested in native C++ classes
+		if(!Class->IsNative())
+		{
+			continue;
+		}
+
+		// Ignore deprecated
+		if(Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		// Check this class is a subclass of Base
+		if(!Class->IsChildOf(UValidationBase::StaticClass()))
+		{
+			continue;
+		}
+
+		// TODO This is horrible, but the UClass abstract flag check does not work because it also gets inherited so the base class
+		// TODO and all the validations which inherit also show as abstract
+		if(Class == UValidationBase::StaticClass())
+		{
+			continue;
+		}
+		CodeValidations.Add(Class->GetDefaultObject());
+	}
+
+	bCodeValidationsDirty = false;
+	bValidationIndexDirty = true;
+}
+
+void UValidationRegistrySubsystem::RebuildValidationIndex()
+{
+	ValidationIndex.Reset(CodeValidations.Num() + BlueprintValidations.Num());
+	ValidationQueryCache.Reset();
+
+	auto AddEntries = [this](const TArray<TObjectPtr<UObject>>& Validations)
+	{
+		for (UObject* Item : Validations)
+		{
+			UValidationBase* Validation = Cast<UValidationBase>(Item);
+			if (Validation == nullptr)
+			{
+				continue;
+			}
+
+			FValidationIndexEntry& Entry = ValidationIndex.AddDefaulted_GetRef();
+			Entry.Validation = Validation;
+			Entry.WorkflowMask = ValidationWorkflowsToMask(Validation->ValidationApplicableWorkflows);
+			Entry.ScopeMask = ValidationScopeToMask(Validation->ValidationScope);
+		}
+	};
+	AddEntries(CodeValidations);
+	AddEntries(BlueprintValidations);
+
+	// Sort by display name, falling back to the class path so validations sharing a name keep a stable order
+	ValidationIndex.Sort([](const FValidationIndexEntry& A, const FValidationIndexEntry& B)
+	{
+		const int32 NameCompare = A.Validation->ValidationName.Compare(B.Validation->ValidationName, ESearchCase::IgnoreCase);
+		if (NameCompare != 0)
+		{
+			return NameCompare < 0;
+		}
+		return A.Validation->GetClass()->GetPathName() < B.Validation->GetClass()->GetPathName();
+	});
+
+	bValidationIndexDirty = false;
+}
+
+void UValidationRegistrySubsystem::RebuildBlueprintValidations()
+{
+	const uint32 Generation = ++BlueprintRebuildGeneration;
+	const TArray<FSoftObjectPath> ClassPaths = GatherBlueprintValidationClassPaths();
+
+	// All of the classes are requested as one batch so their packages and dependencies load together, we only wait on
+	// it here because our caller needs the validations straight away
+	const TSharedPtr<FStreamableHandle> Handle = RequestBlueprintClassLoad(ClassPaths, FStreamableDelegate());
+	if (Handle.IsValid())
+	{
+		Handle->WaitUntilComplete();
+	}
+	OnBlueprintRebuildLoaded(ClassPaths, Generation);
+}
+
+void UValidationRegistrySubsystem::UpdateBlueprintValidations()
+{
+	if (bBlueprintValidationsDirty)
+	{
+		RebuildBlueprintValidations();
+	}
+	else if (IsDiscoveringValidations())
+	{
+		MergeDiscoveredBlueprints();
+	}
+}
+
+void UValidationRegistrySubsystem::MergeDiscoveredBlueprints()
+{
+	// Discoveries which are already loading add themselves to the registry as they complete
+	const TArray<TSharedPtr<FStreamableHandle>> InFlightHandles = BlueprintClassHandles;
+	for (const TSharedPtr<FStreamableHandle>& InFlightHandle : InFlightHandles)
+	{
+		if (InFlightHandle.IsValid())
+		{
+			InFlightHandle->WaitUntilComplete();
+		}
+	}
+
+	// Anything found since is loaded now rather than on the next tick, as our caller needs the validations straight away
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+	const TArray<FSoftObjectPath> ClassPaths = MoveTemp(DiscoveredBlueprintClassPaths);
+	DiscoveredBlueprintClassPaths.Reset();
+	const TSharedPtr<FStreamableHandle> Handle = RequestBlueprintClassLoad(ClassPaths, FStreamableDelegate());
+	if (Handle.IsValid())
+	{
+		Handle->WaitUntilComplete();
+	}
+	OnDiscoveredBlueprintsLoaded(ClassPaths, BlueprintRebuildGeneration);
+	bBlueprintValidationsDirty = false;
+}
+
+void UValidationRegistrySubsystem::RebuildBlueprintValidationsAsync()
+{
+	const uint32 Generation = ++BlueprintRebuildGeneration;
+	const TArray<FSoftObjectPath> ClassPaths = GatherBlueprintValidationClassPaths();
+	RequestBlueprintClassLoad(ClassPaths, FStreamableDelegate::CreateUObject(
+		this, &UValidationRegistrySubsystem::OnBlueprintRebuildLoaded, ClassPaths, Generation));
+}
+
+TArray<FSoftObjectPath> UValidationRegistrySubsystem::GatherBlueprintValidationClassPaths()
+{
+	TArray<FSoftObjectPath> ClassPaths;
+	DiscoveredBlueprintClassPaths.Reset();
+	ContentPaths = GetValidationContentPaths();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry")).Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// Only synchronous callers get here before the asset registry has finished loading, asynchronous callers wait
+		// for OnFilesLoaded instead. We only scan the validation content rather than the entire project, falling back
+		// to the game content when no validation content paths have been configured
+		TArray< FString > ScanPaths = ContentPaths;
+		if (ScanPaths.IsEmpty())
+		{
+			ScanPaths.Add(TEXT("/Game"));
+		}
+		AssetRegistry.ScanPathsSynchronous(ScanPaths);
+	}
+
+	// Use the asset registry to get the set of all class names deriving from Base
+	TSet< FTopLevelAssetPath > DerivedPaths;
+	{
+		TArray< FTopLevelAssetPath > BaseNames;
+		BaseNames.Add(UValidationBase::StaticClass()->GetClassPathName());
+
+		TSet< FTopLevelAssetPath > Excluded;
+		AssetRegistry.GetDerivedClassNames(BaseNames, Excluded, DerivedPaths);
+	}
+
+	TSet< FName > DerivedNames;
+	for(auto const& DerivedPath : DerivedPaths)
+	{
+		DerivedNames.Add(DerivedPath.GetAssetName());
+	}
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+	for (const FString& ContentPath : ContentPaths)
+	{
+		Filter.PackagePaths.Add(FName(*ContentPath));
+	}
+
+	TArray< FAssetData > AssetList;
+	AssetRegistry.GetAssets(Filter, AssetList);
+
+	// Iterate over retrieved blueprint assets
+	for(auto const& Asset : AssetList)
+	{
+		// Get the the class this blueprint generates (this is stored as a full path)
+		FAssetTagValueRef Result = Asset.TagsAndValues.FindTag(FBlueprintTags::GeneratedClassPath);
+		FAssetRegistryExportPath ExportPath = Result.AsExportPath();
+		if(ExportPath.ToString().IsEmpty())
+		{
+			continue;
+		}
+
+		// Convert path to just the name part
+		const FString ClassObjectPath = FPackageName::ExportTextPathToObjectPath(ExportPath.ToString());
+		const FString ClassName = FPackageName::ObjectPathToObjectName(ClassObjectPath);
+
+		// Check if this class is in the derived set
+		if(!DerivedNames.Contains(*ClassName))
+		{
+			continue;
+		}
+
+		ClassPaths.Add(FSoftObjectPath(ClassObjectPath));
+	}
+
+	return ClassPaths;
+}
+
+TSharedPtr<FStreamableHandle> UValidationRegistrySubsystem::RequestBlueprintClassLoad(
+	const TArray<FSoftObjectPath>& ClassPaths, FStreamableDelegate OnLoaded)
+{
+	// Drop any handles which have already finished, the loaded classes are held by BlueprintValidationClasses
+	BlueprintClassHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle)
+	{
+		return !Handle.IsValid() || Handle->HasLoadCompletedOrStalled();
+	});
+
+	if (ClassPaths.IsEmpty())
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		ClassPaths, MoveTemp(OnLoaded), FStreamableManager::AsyncLoadHighPriority);
+	if (Handle.IsValid())
+	{
+		BlueprintClassHandles.Add(Handle);
+	}
+	return Handle;
+}
+
+void UValidationRegistrySubsystem::AddBlueprintValidationClasses(
+	const TArray<FSoftObjectPath>& ClassPaths, TArray<UObject*>* OutNewValidations)
+{
+	for (const FSoftObjectPath& ClassPath : ClassPaths)
+	{
+		UClass* ClassLoaded = Cast<UClass>(ClassPath.ResolveObject());
+		if (ClassLoaded == nullptr)
+		{
+			continue;
+		}
+
+		UObject* Object = ClassLoaded->GetDefaultObject();
+		if (BlueprintValidations.Contains(Object))
+		{
+			continue;
+		}
+
+		BlueprintValidationClasses.AddUnique(ClassLoaded);
+		BlueprintValidations.Add(Object);
+		bValidationIndexDirty = true;
+		if (OutNewValidations)
+		{
+			OutNewValidations->Add(Object);
+		}
+	}
+}
+
+void UValidationRegistrySubsystem::OnBlueprintRebuildLoaded(TArray<FSoftObjectPath> ClassPaths, uint32 Generation)
+{
+	// A newer rebuild has been started since this one was requested so its results take precedence
+	if (Generation != BlueprintRebuildGeneration)
+	{
+		return;
+	}
+
+	// The previous classes are only released once the new set is loaded, so unchanged validations are never unloaded
+	// and reloaded between rebuilds
+	BlueprintValidations.Reset();
+	BlueprintValidationClasses.Reset();
+	AddBlueprintValidationClasses(ClassPaths, nullptr);
+	bBlueprintValidationsDirty = false;
+	bValidationIndexDirty = true;
+
+	if (!IsDiscoveringValidations())
+	{
+		FulfillPendingRequests();
+	}
+}
+
+bool UValidationRegistrySubsystem::IsPotentialValidationBlueprint(const FAssetData& AssetData)
+{
+	// Only blueprints carry a generated class tag, this keeps the check cheap for the thousands of other assets
+	// which are reported while the asset registry is scanning
+	return AssetData.TagsAndValues.Contains(FBlueprintTags::GeneratedClassPath);
+}
+
+bool UValidationRegistrySubsystem::IsValidationBlueprint(const FAssetData& AssetData) const
+{
+	if (!IsPotentialValidationBlueprint(AssetData))
+	{
+		return false;
+	}
+
+	if (ContentPaths.Num())
+	{
+		const FNameBuilder PackagePath(AssetData.PackagePath);
+		const FStringView PackagePathView = PackagePath.ToView();
+		const bool bInContentPaths = ContentPaths.ContainsByPredicate([&PackagePathView](const FString& ContentPath)
+		{
+			return PackagePathView.StartsWith(ContentPath) &&
+				(PackagePathView.Len() == ContentPath.Len() || PackagePathView[ContentPath.Len()] == TEXT('/'));
+		});
+		if (!bInContentPaths)
+		{
+			return false;
+		}
+	}
+
+	// The native parent is always loaded so can be resolved without loading the blueprint itself
+	const FString NativeParentClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
+	if (NativeParentClassPath.IsEmpty())
+	{
+		return false;
+	}
+
+	const UClass* NativeParentClass = FSoftClassPath(FPackageName::ExportTextPathToObjectPath(NativeParentClassPath)).ResolveClass();
+	return NativeParentClass != nullptr && NativeParentClass->IsChildOf(UValidationBase::StaticClass());
+}
+
+TArray<FString> UValidationRegistrySubsystem::GetValidationContentPaths()
+{
+	TArray<FString> Paths;
+	const UVFProjectSettingsEditor* ProjectSettings = GetDefault<UVFProjectSettingsEditor>();
+	for (const FDirectoryPath& Directory : ProjectSettings->ValidationContentPaths)
+	{
+		FString Path = Directory.Path;
+		Path.RemoveFromEnd(TEXT("/"));
+		if (!Path.IsEmpty())
+		{
+			Paths.AddUnique(Path);
+		}
+	}
+
+	// The validations shipped with the framework always need to be found, but if nothing has been configured we leave
+	// the paths empty so that all content is searched
+	if (Paths.Num())
+	{
+		Paths.AddUnique(TEXT("/ValidationFramework"));
+	}
+	return Paths;
+}
+
+bool UValidationRegistrySubsystem::FlushDiscoveredBlueprints(float DeltaTime)
+{
+	FlushTickerHandle.Reset();
+
+	const TArray<FSoftObjectPath> ClassPaths = MoveTemp(DiscoveredBlueprintClassPaths);
+	DiscoveredBlueprintClassPaths.Reset();
+	RequestBlueprintClassLoad(ClassPaths, FStreamableDelegate::CreateUObject(
+		this, &UValidationRegistrySubsystem::OnDiscoveredBlueprintsLoaded, ClassPaths, BlueprintRebuildGeneration));
+	return false;
+}
+
+void UValidationRegistrySubsystem::OnDiscoveredBlueprintsLoaded(TArray<FSoftObjectPath> ClassPaths, uint32 Generation)
+{
+	// A full rebuild has happened in the meantime which will already include these classes
+	if (Generation != BlueprintRebuildGeneration)
+	{
+		return;
+	}
+
+	TArray<UObject*> NewValidations;
+	AddBlueprintValidationClasses(ClassPaths, &NewValidations);
+	if (NewValidations.Num())
+	{
+		OnValidationsDiscovered.Broadcast(NewValidations);
+	}
+}
+
+void UValidationRegistrySubsystem::FulfillPendingRequests()
+{
+	if (PendingRequests.IsEmpty())
+	{
+		return;
+	}
+
+	const TArray<UObject*> ValidationObjects = GetAllValidations();
+	TArray<TPromise<TArray<UObject*>>> Requests = MoveTemp(PendingRequests);
+	for (TPromise<TArray<UObject*>>& Promise : Requests)
+	{
+		Promise.SetValue(ValidationObjects);
+	}
+}
+
+void UValidationRegistrySubsystem::OnAssetAdded(const FAssetData& AssetData)
+{
+	if (!IsPotentialValidationBlueprint(AssetData))
+	{
+		return;
+	}
+
+	if (!IsDiscoveringValidations())
+	{
+		bBlueprintValidationsDirty = true;
+		return;
+	}
+
+	// Whilst the asset registry is loading we add validations as they are found, loads are deferred to the next tick
+	// so that they are grouped together and never happen inside the asset registry callback
+	if (!IsValidationBlueprint(AssetData))
+	{
+		return;
+	}
+
+	const FString GeneratedClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+	DiscoveredBlueprintClassPaths.AddUnique(FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath)));
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UValidationRegistrySubsystem::FlushDiscoveredBlueprints));
+	}
+}
+
+void UValidationRegistrySubsystem::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (IsPotentialValidationBlueprint(AssetData))
+	{
+		bBlueprintValidationsDirty = true;
+	}
+}
+
+void UValidationRegistrySubsystem::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (IsPotentialValidationBlueprint(AssetData))
+	{
+		bBlueprintValidationsDirty = true;
+	}
+}
+
+void UValidationRegistrySubsystem::OnFilesLoaded()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	// Discovery has finished so rebuild once from the complete asset registry, anyone waiting on it is released once
+	// the batched load of the blueprint classes has completed
+	bBlueprintValidationsDirty = true;
+	if (PendingRequests.Num())
+	{
+		RebuildBlueprintValidationsAsync();
+	}
+}
+
+void UValidationRegistrySubsystem::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	if (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded)
+	{
+		bCodeValidationsDirty = true;
+	}
+}
+
+void UValidationRegistrySubsystem::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	bCodeValidationsDirty = true;
+	bBlueprintValidationsDirty = true;
+}
+
+void UValidationRegistrySubsystem::OnBlueprintCompiled()
+{
+	bBlueprintValidationsDirty = true;
+}
@@ -0,0 +1,300 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationRunContext.h"
+
+#include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
+#include "ValidationMeshExclusions.h"
+#include "ValidationOCIOResolver.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+
+
+FValidationRunContext* FValidationRunContext::ActiveContext = nullptr;
+
+FValidationRunContext::FValidationRunContext(UWorld* InWorld)
+	: World(InWorld)
+	, MeshExclusions(FValidationMeshExclusions::CompileProjectSettings())
+	, OCIOResolver(MakeShared<FValidationOCIOResolver>())
+{
+	check(IsInGameThread());
+
+	WorldSnapshot = MakeShared<const FValidationWorldSnapshot>(InWorld);
+	if (GEngine)
+	{
+		LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FValidationRunContext::OnLevelActorsChanged);
+		LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FValidationRunContext::OnLevelActorsChanged);
+	}
+
+	PreviousContext = ActiveContext;
+	ActiveContext = this;
+}
+
+FValidationRunContext::~FValidationRunContext()
+{
+	check(IsInGameThread());
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+	}
+
+	ActiveContext = PreviousContext;
+}
+
+FValidationRunContext* FValidationRunContext::Get()
+{
+	return ActiveContext;
+}
+
+UWorld* FValidationRunContext::GetWorld() const
+{
+	return World.Get();
+}
+
+TSharedRef<const FValidationWorldSnapshot> FValidationRunContext::GetWorldSnapshot()
+{
+	// Only the game thread retakes the snapshot, workers which asked earlier share ownership of the one they were given
+	if (bWorldSnapshotDirty && IsInGameThread())
+	{
+		TSharedRef<const FValidationWorldSnapshot> NewSnapshot = MakeShared<const FValidationWorldSnapshot>(World.Get());
+		FScopeLock Lock(&WorldSnapshotLock);
+		WorldSnapshot = NewSnapshot;
+		bWorldSnapshotDirty = false;
+		return NewSnapshot;
+	}
+
+	FScopeLock Lock(&WorldSnapshotLock);
+	return WorldSnapshot.ToSharedRef();
+}
+
+TSharedRef<const FValidationMeshAnalysis> FValidationRunContext::GetMeshAnalysis(const uint32 UVLayoutChannelMask)
+{
+	// Validations asking at the same time wait for the first to finish the analysis rather than repeating it
+	FScopeLock Lock(&MeshAnalysisLock);
+	const uint32 CurrentLayoutChannelMask = MeshAnalysis.IsValid() ? MeshAnalysis->GetUVLayoutChannelMask() : 0;
+	const bool bMissingLayouts = (UVLayoutChannelMask & ~CurrentLayoutChannelMask) != 0;
+	if (!MeshAnalysis.IsValid() || bMissingLayouts || (bMeshAnalysisDirty && IsInGameThread()))
+	{
+		check(IsInGameThread());
+
+		// Layouts already analyzed are kept, so validations asking for different channels do not rebuild in turn
+		MeshAnalysis = MakeShared<FValidationMeshAnalysis>(World.Get(), CurrentLayoutChannelMask | UVLayoutChannelMask);
+		bMeshAnalysisDirty = false;
+	}
+	return MeshAnalysis.ToSharedRef();
+}
+
+FValidationResult FValidationRunContext::RunValidation(UValidationBase* Validation)
+{
+	if (Validation == nullptr)
+	{
+		return FValidationResult(EValidationStatus::Fail, "Invalid Validation");
+	}
+
+	const UClass* ValidationClass = Validation->GetClass();
+	const TSharedRef<FValidationMemo> Memo = FindOrAddValidationMemo(ValidationClass);
+	const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+	const bool bGameThread = IsInGameThread();
+
+	// The memo lock is never held whilst a validation runs, so validations on different threads which depend on each
+	// other wait on the memo events instead, where a cycle can be detected rather than deadlocking
+	while (true)
+	{
+		FEvent* RunningEvent = nullptr;
+		{
+			FScopeLock MemoLock(&Memo->Lock);
+			if (Memo->Result.IsSet())
+			{
+				return Memo->Result.GetValue();
+			}
+
+			if (Memo->bRunning)
+			{
+				RunningEvent = Memo->Done.Get();
+			}
+			else if (!bGameThread && !Validation->CanRunValidationOffGameThread())
+			{
+				// Not memoized so it can still be run once we are back on the game thread
+				return FValidationResult(EValidationStatus::Fail, Validation->ValidationName + " Must Be Run On The Game Thread");
+			}
+			else
+			{
+				Memo->bRunning = true;
+				Memo->Done->Reset();
+				FScopeLock RunningLock(&RunningThreadsLock);
+				RunningThreads.Add(ValidationClass, ThreadId);
+			}
+		}
+
+		if (RunningEvent == nullptr)
+		{
+			break;
+		}
+
+		if (!BeginWaitingForValidation(ValidationClass, ThreadId))
+		{
+			return FValidationResult(EValidationStatus::Fail, "Circular Validation Dependency On " + Validation->ValidationName);
+		}
+		RunningEvent->Wait();
+		EndWaitingForValidation(ThreadId);
+	}
+
+	// The BlueprintNativeEvent thunk goes through ProcessEvent so call the implementation directly away from the game thread
+	const FValidationResult Result = bGameThread ? Validation->Validation() : Validation->Validation_Implementation();
+
+	{
+		FScopeLock MemoLock(&Memo->Lock);
+		{
+			FScopeLock RunningLock(&RunningThreadsLock);
+			RunningThreads.Remove(ValidationClass);
+		}
+		Memo->Result = Result;
+		Memo->bRunning = false;
+		Memo->Done->Trigger();
+	}
+	return Result;
+}
+
+bool FValidationRunContext::BeginWaitingForValidation(const UClass* ValidationClass, const uint32 ThreadId)
+{
+	FScopeLock RunningLock(&RunningThreadsLock);
+
+	// Follow the chain of threads running the validation we want, and what those threads are themselves waiting for
+	const UClass* WaitedFor = ValidationClass;
+	for (int32 Depth = 0; Depth <= WaitingThreads.Num(); ++Depth)
+	{
+		const uint32* RunningThread = RunningThreads.Find(WaitedFor);
+		if (RunningThread == nullptr)
+		{
+			break;
+		}
+		if (*RunningThread == ThreadId)
+		{
+			return false;
+		}
+
+		const UClass* const* Next = WaitingThreads.Find(*RunningThread);
+		if (Next == nullptr)
+		{
+			break;
+		}
+		WaitedFor = *Next;
+	}
+
+	WaitingThreads.Add(ThreadId, ValidationClass);
+	return true;
+}
+
+void FValidationRunContext::EndWaitingForValidation(const uint32 ThreadId)
+{
+	FScopeLock RunningLock(&RunningThreadsLock);
+	WaitingThreads.Remove(ThreadId);
+}
+
+void FValidationRunContext::AddValidationResult(const UValidationBase* Validation, const FValidationResult& Result)
+{
+	if (Validation == nullptr)
+	{
+		return;
+	}
+
+	const TSharedRef<FValidationMemo> Memo = FindOrAddValidationMemo(Validation->GetClass());
+	FScopeLock MemoLock(&Memo->Lock);
+	Memo->Result = Result;
+}
+
+FValidationFixResult FValidationRunContext::RunFix(UValidationBase* Validation)
+{
+	check(IsInGameThread());
+
+	if (Validation == nullptr)
+	{
+		return FValidationFixResult(EValidationFixStatus::NotFixed, "Invalid Validation");
+	}
+
+	const UClass* ValidationClass = Validation->GetClass();
+	if (const FValidationFixResult* FixResult = FixResults.Find(ValidationClass))
+	{
+		return *FixResult;
+	}
+
+	const FValidationFixResult FixResult = Validation->Fix();
+	FixResults.Add(ValidationClass, FixResult);
+
+	// Anything checked by this validation or the validations depending on it may now have changed. Fixes can also edit
+	// meshes, such as their build settings, which the shared mesh analysis would otherwise still describe as before
+	InvalidateValidationResult(ValidationClass);
+	bMeshAnalysisDirty = true;
+	return FixResult;
+}
+
+TSharedRef<FValidationRunContext::FValidationMemo> FValidationRunContext::FindOrAddValidationMemo(const UClass* ValidationClass)
+{
+	FScopeLock MemosLock(&ValidationMemosLock);
+	if (const TSharedRef<FValidationMemo>* Memo = ValidationMemos.Find(ValidationClass))
+	{
+		return *Memo;
+	}
+	return ValidationMemos.Add(ValidationClass, MakeShared<FValidationMemo>());
+}
+
+void FValidationRunContext::InvalidateValidationResult(const UClass* ValidationClass)
+{
+	TArray<const UClass*> Invalidate;
+	Invalidate.Add(ValidationClass);
+
+	TArray<TSharedRef<FValidationMemo>> Memos;
+	{
+		FScopeLock MemosLock(&ValidationMemosLock);
+		for (int32 Index = 0; Index < Invalidate.Num(); ++Index)
+		{
+			const UClass* Changed = Invalidate[Index];
+			if (const TSharedRef<FValidationMemo>* Memo = ValidationMemos.Find(Changed))
+			{
+				Memos.Add(*Memo);
+			}
+
+			// Follow the declared dependencies back to any memoized validations which depend on the changed one
+			for (const TPair<const UClass*, TSharedRef<FValidationMemo>>& Pair : ValidationMemos)
+			{
+				const UValidationBase* Dependent = Cast<UValidationBase>(Pair.Key->GetDefaultObject(false));
+				if (Dependent && Dependent->DependsOn(Changed))
+				{
+					Invalidate.AddUnique(Pair.Key);
+				}
+			}
+		}
+	}
+
+	// Only take the memo locks once the map lock is released, so the two are never held together
+	for (const TSharedRef<FValidationMemo>& Memo : Memos)
+	{
+		FScopeLock MemoLock(&Memo->Lock);
+		Memo->Result.Reset();
+	}
+}
+
+void FValidationRunContext::OnLevelActorsChanged(AActor* Actor)
+{
+	if (Actor && Actor->GetWorld() == World.Get())
+	{
+		bWorldSnapshotDirty = true;
+		bMeshAnalysisDirty = true;
+	}
+}
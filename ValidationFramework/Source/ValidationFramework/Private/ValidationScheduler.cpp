@@ -0,0 +1,133 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationScheduler.h"
+
+#include "ValidationBase.h"
+#include "ValidationRunContext.h"
+#include "Misc/App.h"
+#include "Tasks/Task.h"
+#include "UObject/GarbageCollection.h"
+
+
+TArray<FValidationResult> FValidationScheduler::RunValidations(const TArray<UValidationBase*>& Validations)
+{
+	check(IsInGameThread());
+
+	TArray<FValidationResult> Results;
+	Results.SetNum(Validations.Num());
+
+	// Thread safe validations cannot walk the world themselves and share their results through the run, so make sure
+	// there is a run context for them to use
+	TOptional<FValidationRunContext> LocalRunContext;
+	if (FValidationRunContext::Get() == nullptr)
+	{
+		LocalRunContext.Emplace(UValidationBase::GetCorrectValidationWorld());
+	}
+	FValidationRunContext& RunContext = *FValidationRunContext::Get();
+
+	// Kick off the thread safe validations first so they run alongside the game thread bound ones. Each task writes
+	// only to its own result slot so no further synchronisation is needed
+	TArray<UE::Tasks::FTask> Tasks;
+	if (FApp::ShouldUseThreadingForPerformance())
+	{
+		for (int32 Index = 0; Index < Validations.Num(); ++Index)
+		{
+			UValidationBase* Validation = Validations[Index];
+			if (Validation == nullptr || !Validation->CanRunValidationOffGameThread())
+			{
+				continue;
+			}
+
+			// Any dependencies which have to run on the game thread are run up front so the task only reads their results
+			RunGameThreadDependencies(RunContext, Validation);
+
+			Tasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Validation, &Results, &RunContext, Index]()
+			{
+				// Stops garbage collection from running whilst we are reading UObjects from this thread
+				FGCScopeGuard GCGuard;
+				Results[Index] = RunContext.RunValidation(Validation);
+			}));
+		}
+	}
+
+	for (int32 Index = 0; Index < Validations.Num(); ++Index)
+	{
+		UValidationBase* Validation = Validations[Index];
+		if (Validation == nullptr)
+		{
+			Results[Index] = FValidationResult(EValidationStatus::Fail, "Invalid Validation");
+			continue;
+		}
+
+		if (Tasks.Num() && Validation->CanRunValidationOffGameThread())
+		{
+			continue;
+		}
+
+		Results[Index] = RunContext.RunValidation(Validation);
+	}
+
+	UE::Tasks::Wait(Tasks);
+	return Results;
+}
+
+TArray<FValidationFixResult> FValidationScheduler::RunFixes(const TArray<UValidationBase*>& Validations)
+{
+	check(IsInGameThread());
+
+	TOptional<FValidationRunContext> LocalRunContext;
+	if (FValidationRunContext::Get() == nullptr)
+	{
+		LocalRunContext.Emplace(UValidationBase::GetCorrectValidationWorld());
+	}
+	FValidationRunContext& RunContext = *FValidationRunContext::Get();
+
+	// Fixes modify the project and level so are always applied one after another on the game thread
+	TArray<FValidationFixResult> Results;
+	Results.Reserve(Validations.Num());
+	for (UValidationBase* Validation : Validations)
+	{
+		Results.Add(RunContext.RunFix(Validation));
+	}
+	return Results;
+}
+
+void FValidationScheduler::RunGameThreadDependencies(FValidationRunContext& RunContext, const UValidationBase* Validation)
+{
+	TArray<const UValidationBase*> Visited;
+	TArray<const UValidationBase*> Pending;
+	Pending.Add(Validation);
+	while (Pending.Num())
+	{
+		const UValidationBase* Current = Pending.Pop(EAllowShrinking::No);
+		for (const TSubclassOf<UValidationBase>& Dependency : Current->ValidationDependencies)
+		{
+			UValidationBase* DependencyValidation = Dependency ? Dependency->GetDefaultObject<UValidationBase>() : nullptr;
+			if (DependencyValidation == nullptr || Visited.Contains(DependencyValidation))
+			{
+				continue;
+			}
+			Visited.Add(DependencyValidation);
+			Pending.Add(DependencyValidation);
+
+			if (!DependencyValidation->CanRunValidationOffGameThread())
+			{
+				RunContext.RunValidation(DependencyValidation);
+			}
+		}
+	}
+}
@@ -0,0 +1,394 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationUVBounds.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Math/VectorRegister.h"
+#include "Rendering/StaticMeshVertexBuffer.h"
+
+namespace ValidationUVBounds
+{
+	/**
+	* Running bounds of the two uv pairs held in one register, along with how many of each pair were out of range
+	*/
+	struct FAccumulator
+	{
+		VectorRegister4Float Min = VectorSetFloat1(MAX_flt);
+		VectorRegister4Float Max = VectorSetFloat1(-MAX_flt);
+		uint32 NumOutOfRange[2] = { 0, 0 };
+	};
+
+	/**
+	* Every register holds two uv pairs, so the channels a register covers repeat every NumPhases registers
+	*/
+	uint32 GetNumPhases(const uint32 NumChannels)
+	{
+		return NumChannels % 2 == 0 ? NumChannels / 2 : NumChannels;
+	}
+
+	void AccumulateScalar(const FVector2f& UV, FValidationUVChannelBounds& Channel)
+	{
+		Channel.Min = FVector2f::Min(Channel.Min, UV);
+		Channel.Max = FVector2f::Max(Channel.Max, UV);
+		Channel.NumOutOfRange += !(UV.X >= 0.0f && UV.X <= 1.0f && UV.Y >= 0.0f && UV.Y <= 1.0f);
+	}
+
+	/**
+	* Accumulates whole periods of registers, returning how many floats were consumed so the caller can finish any
+	* remainder with AccumulateScalar
+	*/
+	uint64 AccumulateVector(const float* Data, const uint64 NumFloats, const uint32 NumPhases, FAccumulator* Accumulators)
+	{
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		const VectorRegister4Float One = VectorOneFloat();
+		const uint64 PeriodFloats = 4 * NumPhases;
+		const uint64 VectorFloats = NumFloats - NumFloats % PeriodFloats;
+
+		for (uint64 Offset = 0; Offset < VectorFloats; Offset += PeriodFloats)
+		{
+			for (uint32 Phase = 0; Phase < NumPhases; ++Phase)
+			{
+				FAccumulator& Accumulator = Accumulators[Phase];
+				const VectorRegister4Float UVs = VectorLoad(Data + Offset + Phase * 4);
+				Accumulator.Min = VectorMin(Accumulator.Min, UVs);
+				Accumulator.Max = VectorMax(Accumulator.Max, UVs);
+
+				// Written as not in range so that nans are counted as out of range
+				const VectorRegister4Float InRange = VectorBitwiseAnd(VectorCompareGE(UVs, Zero), VectorCompareLE(UVs, One));
+				const uint32 OutOfRangeLanes = ~static_cast<uint32>(VectorMaskBits(InRange)) & 0xF;
+				Accumulator.NumOutOfRange[0] += (OutOfRangeLanes & 0x3) != 0;
+				Accumulator.NumOutOfRange[1] += (OutOfRangeLanes & 0xC) != 0;
+			}
+		}
+		return VectorFloats;
+	}
+
+	/**
+	* Folds the per phase registers back into the channels their pairs belong to
+	*/
+	void Reduce(const FAccumulator* Accumulators, const uint32 NumPhases, const uint32 NumChannels, TArrayView<FValidationUVChannelBounds> OutChannels)
+	{
+		for (uint32 Phase = 0; Phase < NumPhases; ++Phase)
+		{
+			alignas(16) float Min[4];
+			alignas(16) float Max[4];
+			VectorStoreAligned(Accumulators[Phase].Min, Min);
+			VectorStoreAligned(Accumulators[Phase].Max, Max);
+			for (uint32 Pair = 0; Pair < 2; ++Pair)
+			{
+				FValidationUVChannelBounds& Channel = OutChannels[(Phase * 2 + Pair) % NumChannels];
+				Channel.Min = FVector2f::Min(Channel.Min, FVector2f(Min[Pair * 2], Min[Pair * 2 + 1]));
+				Channel.Max = FVector2f::Max(Channel.Max, FVector2f(Max[Pair * 2], Max[Pair * 2 + 1]));
+				Channel.NumOutOfRange += Accumulators[Phase].NumOutOfRange[Pair];
+			}
+		}
+	}
+
+	/**
+	* Accumulates the largest change from round tripping whole periods of registers through half precision, returning
+	* how many floats were consumed so the caller can finish any remainder with AccumulateHalfPrecisionErrorScalar
+	*/
+	uint64 AccumulateHalfPrecisionError(const float* Data, const uint64 NumFloats, const uint32 NumPhases, VectorRegister4Float* MaxErrors)
+	{
+		const uint64 PeriodFloats = 4 * NumPhases;
+		const uint64 VectorFloats = NumFloats - NumFloats % PeriodFloats;
+		alignas(16) uint16 Halves[4];
+		alignas(16) float RoundTripped[4];
+
+		for (uint64 Offset = 0; Offset < VectorFloats; Offset += PeriodFloats)
+		{
+			for (uint32 Phase = 0; Phase < NumPhases; ++Phase)
+			{
+				const float* Floats = Data + Offset + Phase * 4;
+				FPlatformMath::VectorStoreHalf(Halves, Floats);
+				FPlatformMath::VectorLoadHalf(RoundTripped, Halves);
+				const VectorRegister4Float Error = VectorAbs(VectorSubtract(VectorLoadAligned(RoundTripped), VectorLoad(Floats)));
+				MaxErrors[Phase] = VectorMax(MaxErrors[Phase], Error);
+			}
+		}
+		return VectorFloats;
+	}
+
+	void AccumulateHalfPrecisionErrorScalar(const FVector2f& UV, FVector2f& MaxError)
+	{
+		const FVector2f RoundTripped = FVector2f(FVector2DHalf(UV));
+		MaxError = FVector2f::Max(MaxError, (RoundTripped - UV).GetAbs());
+	}
+}
+
+bool FValidationUVBounds::Compute(const FStaticMeshVertexBuffer& VertexBuffer, TArray<FValidationUVChannelBounds>& OutChannels)
+{
+	const uint32 NumVertices = VertexBuffer.GetNumVertices();
+	const uint32 NumChannels = VertexBuffer.GetNumTexCoords();
+	OutChannels.Reset();
+	OutChannels.SetNum(NumChannels);
+	if (NumVertices == 0 || NumChannels == 0)
+	{
+		return true;
+	}
+
+	const void* TexCoordData = VertexBuffer.GetTexCoordData();
+	if (TexCoordData == nullptr)
+	{
+		return false;
+	}
+
+	if (VertexBuffer.GetUseFullPrecisionUVs())
+	{
+		ComputeFloat(static_cast<const FVector2f*>(TexCoordData), NumVertices, NumChannels, OutChannels);
+	}
+	else
+	{
+		ComputeHalf(static_cast<const FVector2DHalf*>(TexCoordData), NumVertices, NumChannels, OutChannels);
+	}
+	return true;
+}
+
+void FValidationUVBounds::ComputeFloat(const FVector2f* UVs, const uint32 NumVertices, const uint32 NumChannels, TArrayView<FValidationUVChannelBounds> OutChannels)
+{
+	check(OutChannels.Num() >= static_cast<int32>(NumChannels) && NumChannels <= FValidationUVBounds::MaxChannels);
+
+	const uint32 NumPhases = ValidationUVBounds::GetNumPhases(NumChannels);
+	ValidationUVBounds::FAccumulator Accumulators[FValidationUVBounds::MaxChannels];
+
+	const uint64 NumPairs = static_cast<uint64>(NumVertices) * NumChannels;
+	const uint64 VectorFloats = ValidationUVBounds::AccumulateVector(
+		reinterpret_cast<const float*>(UVs), NumPairs * 2, NumPhases, Accumulators);
+	ValidationUVBounds::Reduce(Accumulators, NumPhases, NumChannels, OutChannels);
+
+	// Vector periods always cover a whole number of vertices, so the remaining pairs start at channel 0
+	for (uint64 Pair = VectorFloats / 2; Pair < NumPairs; ++Pair)
+	{
+		ValidationUVBounds::AccumulateScalar(UVs[Pair], OutChannels[Pair % NumChannels]);
+	}
+}
+
+void FValidationUVBounds::ComputeHalf(const FVector2DHalf* UVs, const uint32 NumVertices, const uint32 NumChannels, TArrayView<FValidationUVChannelBounds> OutChannels)
+{
+	check(OutChannels.Num() >= static_cast<int32>(NumChannels) && NumChannels <= FValidationUVBounds::MaxChannels);
+
+	const uint32 NumPhases = ValidationUVBounds::GetNumPhases(NumChannels);
+	ValidationUVBounds::FAccumulator Accumulators[FValidationUVBounds::MaxChannels];
+
+	// Chunks are a whole number of periods so the phase of every register is the same in each chunk
+	constexpr uint32 MaxChunkFloats = 4096;
+	const uint32 PeriodFloats = 4 * NumPhases;
+	const uint64 ChunkFloats = MaxChunkFloats - MaxChunkFloats % PeriodFloats;
+	alignas(16) float Converted[MaxChunkFloats];
+
+	const uint16* Halves = reinterpret_cast<const uint16*>(UVs);
+	const uint64 NumFloats = static_cast<uint64>(NumVertices) * NumChannels * 2;
+	uint64 VectorFloats = 0;
+	for (uint64 ChunkStart = 0; ChunkStart < NumFloats; ChunkStart += ChunkFloats)
+	{
+		const uint64 ChunkSize = FMath::Min(ChunkFloats, NumFloats - ChunkStart);
+		const uint64 ConvertSize = ChunkSize - ChunkSize % 4;
+		for (uint64 Index = 0; Index < ConvertSize; Index += 4)
+		{
+			FPlatformMath::VectorLoadHalf(Converted + Index, Halves + ChunkStart + Index);
+		}
+		VectorFloats += ValidationUVBounds::AccumulateVector(Converted, ConvertSize, NumPhases, Accumulators);
+	}
+	ValidationUVBounds::Reduce(Accumulators, NumPhases, NumChannels, OutChannels);
+
+	const uint64 NumPairs = NumFloats / 2;
+	for (uint64 Pair = VectorFloats / 2; Pair < NumPairs; ++Pair)
+	{
+		ValidationUVBounds::AccumulateScalar(FVector2f(UVs[Pair]), OutChannels[Pair % NumChannels]);
+	}
+}
+
+bool FValidationUVBounds::ComputeHalfPrecisionError(const FStaticMeshVertexBuffer& VertexBuffer, TArray<FVector2f>& OutMaxErrors)
+{
+	OutMaxErrors.Reset();
+	const void* TexCoordData = VertexBuffer.GetTexCoordData();
+	if (TexCoordData == nullptr || !VertexBuffer.GetUseFullPrecisionUVs())
+	{
+		return false;
+	}
+
+	OutMaxErrors.SetNumZeroed(VertexBuffer.GetNumTexCoords());
+	ComputeHalfPrecisionErrorFloat(static_cast<const FVector2f*>(TexCoordData), VertexBuffer.GetNumVertices(), VertexBuffer.GetNumTexCoords(), OutMaxErrors);
+	return true;
+}
+
+void FValidationUVBounds::ComputeHalfPrecisionErrorFloat(const FVector2f* UVs, const uint32 NumVertices, const uint32 NumChannels, TArrayView<FVector2f> OutMaxErrors)
+{
+	check(OutMaxErrors.Num() >= static_cast<int32>(NumChannels) && NumChannels <= FValidationUVBounds::MaxChannels);
+	if (NumChannels == 0)
+	{
+		return;
+	}
+
+	const uint32 NumPhases = ValidationUVBounds::GetNumPhases(NumChannels);
+	VectorRegister4Float MaxErrors[FValidationUVBounds::MaxChannels];
+	for (uint32 Phase = 0; Phase < NumPhases; ++Phase)
+	{
+		MaxErrors[Phase] = VectorZeroFloat();
+	}
+
+	const uint64 NumPairs = static_cast<uint64>(NumVertices) * NumChannels;
+	const uint64 VectorFloats = ValidationUVBounds::AccumulateHalfPrecisionError(
+		reinterpret_cast<const float*>(UVs), NumPairs * 2, NumPhases, MaxErrors);
+
+	for (uint32 Phase = 0; Phase < NumPhases; ++Phase)
+	{
+		alignas(16) float Errors[4];
+		VectorStoreAligned(MaxErrors[Phase], Errors);
+		for (uint32 Pair = 0; Pair < 2; ++Pair)
+		{
+			FVector2f& MaxError = OutMaxErrors[(Phase * 2 + Pair) % NumChannels];
+			MaxError = FVector2f::Max(MaxError, FVector2f(Errors[Pair * 2], Errors[Pair * 2 + 1]));
+		}
+	}
+
+	for (uint64 Pair = VectorFloats / 2; Pair < NumPairs; ++Pair)
+	{
+		ValidationUVBounds::AccumulateHalfPrecisionErrorScalar(UVs[Pair], OutMaxErrors[Pair % NumChannels]);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+namespace ValidationUVBounds
+{
+	/**
+	* The per vertex decoding the kernel replaces, used as the reference the benchmark checks the kernel against
+	*/
+	template<typename UVType>
+	void ComputeReference(const UVType* UVs, const uint32 NumVertices, const uint32 NumChannels, TArrayView<FValidationUVChannelBounds> OutChannels)
+	{
+		for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			for (uint32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+			{
+				AccumulateScalar(FVector2f(UVs[Vertex * NumChannels + Channel]), OutChannels[Channel]);
+			}
+		}
+	}
+
+	template<typename FunctionType>
+	double TimeBest(const int32 Iterations, FunctionType Function)
+	{
+		double Best = MAX_dbl;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Function();
+			Best = FMath::Min(Best, FPlatformTime::Seconds() - Start);
+		}
+		return Best * 1000.0;
+	}
+
+	bool Matches(const TArray<FValidationUVChannelBounds>& A, const TArray<FValidationUVChannelBounds>& B)
+	{
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			if (A[Index].Min != B[Index].Min || A[Index].Max != B[Index].Max || A[Index].NumOutOfRange != B[Index].NumOutOfRange)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* Validation.BenchmarkUVBounds [NumVertices] [NumChannels]
+	* Times the kernels against per vertex decoding on random uvs, a small fraction of which lie outside of 0-1, in both
+	* precisions along with the half precision error, and checks that both produce identical results
+	*/
+	void RunBenchmark(const TArray<FString>& Args)
+	{
+		const uint32 NumVertices = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 2000000;
+		const uint32 NumChannels = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, static_cast<int32>(FValidationUVBounds::MaxChannels)) : 2;
+		constexpr int32 Iterations = 10;
+
+		FRandomStream Random(NumVertices);
+		TArray<FVector2f> FloatUVs;
+		TArray<FVector2DHalf> HalfUVs;
+		FloatUVs.SetNumUninitialized(NumVertices * NumChannels);
+		HalfUVs.SetNumUninitialized(NumVertices * NumChannels);
+		for (int32 Index = 0; Index < FloatUVs.Num(); ++Index)
+		{
+			FloatUVs[Index] = FVector2f(Random.FRandRange(-0.001f, 1.001f), Random.FRandRange(-0.001f, 1.001f));
+			HalfUVs[Index] = FVector2DHalf(FloatUVs[Index]);
+		}
+
+		TArray<FValidationUVChannelBounds> Reference;
+		TArray<FValidationUVChannelBounds> Kernel;
+		auto Run = [&](const TCHAR* Precision, auto ReferenceFunction, auto KernelFunction)
+		{
+			const double ReferenceMs = TimeBest(Iterations, [&]()
+			{
+				Reference.Reset();
+				Reference.SetNum(NumChannels);
+				ReferenceFunction();
+			});
+			const double KernelMs = TimeBest(Iterations, [&]()
+			{
+				Kernel.Reset();
+				Kernel.SetNum(NumChannels);
+				KernelFunction();
+			});
+
+			UE_LOG(LogTemp, Display, TEXT("UV Bounds %s, %u Vertices, %u Channels: Per Vertex %.3f ms, Kernel %.3f ms (%.1fx), %u Out Of Range In Channel 0"),
+				Precision, NumVertices, NumChannels, ReferenceMs, KernelMs, ReferenceMs / FMath::Max(KernelMs, UE_SMALL_NUMBER),
+				Kernel[0].NumOutOfRange);
+			if (!Matches(Reference, Kernel))
+			{
+				UE_LOG(LogTemp, Error, TEXT("UV Bounds %s Kernel Does Not Match The Per Vertex Reference"), Precision);
+			}
+		};
+
+		Run(TEXT("Full Precision"),
+			[&]() { ComputeReference(FloatUVs.GetData(), NumVertices, NumChannels, Reference); },
+			[&]() { FValidationUVBounds::ComputeFloat(FloatUVs.GetData(), NumVertices, NumChannels, Kernel); });
+		Run(TEXT("Half Precision"),
+			[&]() { ComputeReference(HalfUVs.GetData(), NumVertices, NumChannels, Reference); },
+			[&]() { FValidationUVBounds::ComputeHalf(HalfUVs.GetData(), NumVertices, NumChannels, Kernel); });
+
+		TArray<FVector2f> ReferenceErrors;
+		TArray<FVector2f> KernelErrors;
+		ReferenceErrors.SetNumZeroed(NumChannels);
+		KernelErrors.SetNumZeroed(NumChannels);
+		const double ReferenceMs = TimeBest(Iterations, [&]()
+		{
+			for (int32 Index = 0; Index < FloatUVs.Num(); ++Index)
+			{
+				AccumulateHalfPrecisionErrorScalar(FloatUVs[Index], ReferenceErrors[Index % NumChannels]);
+			}
+		});
+		const double KernelMs = TimeBest(Iterations, [&]()
+		{
+			FValidationUVBounds::ComputeHalfPrecisionErrorFloat(FloatUVs.GetData(), NumVertices, NumChannels, KernelErrors);
+		});
+
+		UE_LOG(LogTemp, Display, TEXT("UV Half Precision Error, %u Vertices, %u Channels: Per Vertex %.3f ms, Kernel %.3f ms (%.1fx), Max Error (%g, %g) In Channel 0"),
+			NumVertices, NumChannels, ReferenceMs, KernelMs, ReferenceMs / FMath::Max(KernelMs, UE_SMALL_NUMBER),
+			KernelErrors[0].X, KernelErrors[0].Y);
+		if (ReferenceErrors != KernelErrors)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UV Half Precision Error Kernel Does Not Match The Per Vertex Reference"));
+		}
+	}
+
+	FAutoConsoleCommand BenchmarkCommand(
+		TEXT("Validation.BenchmarkUVBounds"),
+		TEXT("Times the vectorized uv bounds and half precision error kernels against per vertex decoding. Usage: Validation.BenchmarkUVBounds [NumVertices] [NumChannels]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark));
+}
+#endif
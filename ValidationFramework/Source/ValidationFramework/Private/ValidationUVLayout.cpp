@@ -0,0 +1,245 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationUVLayout.h"
+
+#include "RawIndexBuffer.h"
+
+namespace ValidationUVLayout
+{
+	/**
+	* Sub cell precision of the fixed point rasterizer
+	*/
+	constexpr int64 SubCellBits = 8;
+	constexpr int64 CellSize = 1 << SubCellBits;
+
+	struct FFixedPoint
+	{
+		int64 X;
+		int64 Y;
+	};
+
+	FFixedPoint ToFixedPoint(const FVector2f& UV)
+	{
+		// Clamped just outside of 0-1 so wildly out of range uvs cannot overflow the edge functions, those uvs are
+		// reported by the 0-1 validation instead
+		const double Scale = static_cast<double>(FValidationUVLayout::GridResolution * CellSize);
+		return {
+			FMath::RoundToInt64(FMath::Clamp(static_cast<double>(UV.X), -1.0, 2.0) * Scale),
+			FMath::RoundToInt64(FMath::Clamp(static_cast<double>(UV.Y), -1.0, 2.0) * Scale)
+		};
+	}
+
+	int64 Edge(const FFixedPoint& From, const FFixedPoint& To, const int64 X, const int64 Y)
+	{
+		return (To.X - From.X) * (Y - From.Y) - (To.Y - From.Y) * (X - From.X);
+	}
+
+	/**
+	* Samples exactly on an edge belong to only one of the two triangles sharing it, which always traverse the edge in
+	* opposite directions once both are wound counter clockwise
+	*/
+	int64 EdgeBias(const FFixedPoint& From, const FFixedPoint& To)
+	{
+		const int64 DX = To.X - From.X;
+		const int64 DY = To.Y - From.Y;
+		return (DY > 0 || (DY == 0 && DX < 0)) ? 0 : -1;
+	}
+
+	/**
+	* Rasterizes a counter clockwise triangle, sampling at cell centers and saturating each cell at 2
+	*/
+	void Rasterize(const FFixedPoint& A, const FFixedPoint& B, const FFixedPoint& C, TArray<uint8>& Coverage)
+	{
+		const int32 Resolution = FValidationUVLayout::GridResolution;
+		const int32 MinX = FMath::Max(0, static_cast<int32>(FMath::Min3(A.X, B.X, C.X) >> SubCellBits));
+		const int32 MinY = FMath::Max(0, static_cast<int32>(FMath::Min3(A.Y, B.Y, C.Y) >> SubCellBits));
+		const int32 MaxX = FMath::Min(Resolution - 1, static_cast<int32>(FMath::Max3(A.X, B.X, C.X) >> SubCellBits));
+		const int32 MaxY = FMath::Min(Resolution - 1, static_cast<int32>(FMath::Max3(A.Y, B.Y, C.Y) >> SubCellBits));
+		if (MinX > MaxX || MinY > MaxY)
+		{
+			return;
+		}
+
+		const int64 BiasA = EdgeBias(B, C);
+		const int64 BiasB = EdgeBias(C, A);
+		const int64 BiasC = EdgeBias(A, B);
+
+		// Edge functions are linear, so they are stepped across the grid rather than evaluated per cell
+		const int64 StepAX = -(C.Y - B.Y) * CellSize, StepAY = (C.X - B.X) * CellSize;
+		const int64 StepBX = -(A.Y - C.Y) * CellSize, StepBY = (A.X - C.X) * CellSize;
+		const int64 StepCX = -(B.Y - A.Y) * CellSize, StepCY = (B.X - A.X) * CellSize;
+
+		const int64 StartX = MinX * CellSize + CellSize / 2;
+		const int64 StartY = MinY * CellSize + CellSize / 2;
+		int64 RowA = Edge(B, C, StartX, StartY) + BiasA;
+		int64 RowB = Edge(C, A, StartX, StartY) + BiasB;
+		int64 RowC = Edge(A, B, StartX, StartY) + BiasC;
+
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			int64 WA = RowA;
+			int64 WB = RowB;
+			int64 WC = RowC;
+			uint8* Row = Coverage.GetData() + static_cast<int64>(Y) * Resolution;
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				if ((WA | WB | WC) >= 0)
+				{
+					Row[X] = FMath::Min<uint8>(Row[X] + 1, 2);
+				}
+				WA += StepAX;
+				WB += StepBX;
+				WC += StepCX;
+			}
+			RowA += StepAY;
+			RowB += StepBY;
+			RowC += StepCY;
+		}
+	}
+
+	int32 FindRoot(TArray<int32>& Parents, int32 Index)
+	{
+		while (Parents[Index] != Index)
+		{
+			Parents[Index] = Parents[Parents[Index]];
+			Index = Parents[Index];
+		}
+		return Index;
+	}
+
+	void Union(TArray<int32>& Parents, const int32 A, const int32 B)
+	{
+		const int32 RootA = FindRoot(Parents, A);
+		const int32 RootB = FindRoot(Parents, B);
+		if (RootA != RootB)
+		{
+			Parents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+		}
+	}
+}
+
+FValidationUVLayoutFacts FValidationUVLayout::Analyze(TConstArrayView<FVector2f> UVs, const FIndexArrayView& Indices)
+{
+	using namespace ValidationUVLayout;
+
+	FValidationUVLayoutFacts Facts;
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles == 0 || UVs.IsEmpty())
+	{
+		return Facts;
+	}
+
+	// Render vertices are split wherever any attribute differs, so weld them back together by their uv alone. Sorting
+	// the bit patterns keeps this cache friendly on meshes with millions of vertices
+	TArray<TPair<uint64, int32>> SortedUVs;
+	SortedUVs.Reserve(UVs.Num());
+	for (int32 VertexIndex = 0; VertexIndex < UVs.Num(); ++VertexIndex)
+	{
+		// Adding zero folds -0 into 0 so they weld together
+		const uint64 Key = (static_cast<uint64>(BitCast<uint32>(UVs[VertexIndex].X + 0.0f)) << 32) | BitCast<uint32>(UVs[VertexIndex].Y + 0.0f);
+		SortedUVs.Emplace(Key, VertexIndex);
+	}
+	SortedUVs.Sort([](const TPair<uint64, int32>& A, const TPair<uint64, int32>& B) { return A.Key < B.Key; });
+
+	TArray<int32> WeldedIds;
+	WeldedIds.SetNumUninitialized(UVs.Num());
+	int32 NumWeldedIds = 0;
+	for (int32 Index = 0; Index < SortedUVs.Num(); ++Index)
+	{
+		if (Index > 0 && SortedUVs[Index].Key != SortedUVs[Index - 1].Key)
+		{
+			++NumWeldedIds;
+		}
+		WeldedIds[SortedUVs[Index].Value] = NumWeldedIds;
+	}
+	++NumWeldedIds;
+	SortedUVs.Empty();
+
+	TArray<int32> Parents;
+	Parents.SetNumUninitialized(NumWeldedIds);
+	for (int32 Index = 0; Index < NumWeldedIds; ++Index)
+	{
+		Parents[Index] = Index;
+	}
+	TBitArray<> UsedIds(false, NumWeldedIds);
+
+	TArray<uint8> Coverage;
+	Coverage.SetNumZeroed(GridResolution * GridResolution);
+
+	// Orientation is decided by the majority of the area, so only the minority counts as flipped
+	uint32 NumClockwise = 0;
+	uint32 NumCounterClockwise = 0;
+	double PositiveArea = 0.0;
+	double NegativeArea = 0.0;
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		const uint32 IndexA = Indices[Triangle * 3];
+		const uint32 IndexB = Indices[Triangle * 3 + 1];
+		const uint32 IndexC = Indices[Triangle * 3 + 2];
+		if (!UVs.IsValidIndex(IndexA) || !UVs.IsValidIndex(IndexB) || !UVs.IsValidIndex(IndexC))
+		{
+			continue;
+		}
+
+		const FFixedPoint A = ToFixedPoint(UVs[IndexA]);
+		FFixedPoint B = ToFixedPoint(UVs[IndexB]);
+		FFixedPoint C = ToFixedPoint(UVs[IndexC]);
+		const int64 DoubleArea = Edge(A, B, C.X, C.Y);
+		if (DoubleArea == 0)
+		{
+			continue;
+		}
+
+		Union(Parents, WeldedIds[IndexA], WeldedIds[IndexB]);
+		Union(Parents, WeldedIds[IndexA], WeldedIds[IndexC]);
+		UsedIds[WeldedIds[IndexA]] = true;
+
+		if (DoubleArea < 0)
+		{
+			++NumClockwise;
+			NegativeArea -= static_cast<double>(DoubleArea);
+			Swap(B, C);
+		}
+		else
+		{
+			++NumCounterClockwise;
+			PositiveArea += static_cast<double>(DoubleArea);
+		}
+		Rasterize(A, B, C, Coverage);
+	}
+
+	TSet<int32> IslandRoots;
+	for (TConstSetBitIterator<> It(UsedIds); It; ++It)
+	{
+		IslandRoots.Add(FindRoot(Parents, It.GetIndex()));
+	}
+	Facts.NumIslands = IslandRoots.Num();
+
+	Facts.NumFlippedTriangles = NegativeArea > PositiveArea ? NumCounterClockwise : NumClockwise;
+
+	int64 CoveredCells = 0;
+	int64 OverlapCells = 0;
+	for (const uint8 Cell : Coverage)
+	{
+		CoveredCells += Cell > 0;
+		OverlapCells += Cell > 1;
+	}
+	const double NumCells = static_cast<double>(GridResolution) * GridResolution;
+	Facts.CoveredArea = static_cast<float>(CoveredCells / NumCells);
+	Facts.OverlapArea = static_cast<float>(OverlapCells / NumCells);
+	return Facts;
+}
@@ -0,0 +1,71 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ValidationWorldSnapshot.h"
+
+#include "EngineUtils.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+
+
+FValidationWorldSnapshot::FValidationWorldSnapshot(UWorld* InWorld)
+	: World(InWorld)
+{
+	check(IsInGameThread());
+	if (InWorld == nullptr)
+	{
+		return;
+	}
+
+	// Uses the same iteration as UGameplayStatics::GetAllActorsOfClass so validations see exactly the same actors
+	for (FActorIterator It(InWorld); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		Actors.Add(Actor);
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component)
+			{
+				Components.Add(Component);
+			}
+		}
+	}
+}
+
+UWorld* FValidationWorldSnapshot::GetWorld() const
+{
+	return World.Get();
+}
+
+const TArray<AActor*>& FValidationWorldSnapshot::GetActorsOfClass(const UClass* ActorClass) const
+{
+	return Actors.Query(ActorClass);
+}
+
+const TArray<UActorComponent*>& FValidationWorldSnapshot::GetComponentsOfClass(const UClass* ComponentClass) const
+{
+	return Components.Query(ComponentClass);
+}
+
+int32 FValidationWorldSnapshot::GetNumActors() const
+{
+	return Actors.Objects.Num();
+}
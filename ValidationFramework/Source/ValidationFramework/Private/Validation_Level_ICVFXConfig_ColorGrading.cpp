@@ -15,11 +15,12 @@ limitations under the License.
 */
 
 #include "Validation_Level_ICVFXConfig_ColorGrading.h"
-#include "Kismet/GameplayStatics.h"
-#if PLATFORM_WINDOWS
+#include "ValidationBPLibrary.h"
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
 #include "DisplayClusterRootActor.h"
 #include "DisplayClusterConfigurationTypes.h"
 #include "Components/DisplayClusterICVFXCameraComponent.h"
+#include "ValidationICVFXConfigVisitor.h"
 #endif
 
 
@@ -38,9 +39,9 @@ UValidation_Level_ICVFXConfig_ColorGrading::UValidation_Level_ICVFXConfig_ColorG
 	};
 }
 
-#if PLATFORM_WINDOWS
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
 void UValidation_Level_ICVFXConfig_ColorGrading::ValidateEntireClusterColorGrading(
-	FValidationResult& Result, FString& ActorMessages, const FDisplayClusterConfigurationICVFX_StageSettings StageSettings)
+	FValidationResult& Result, FString& ActorMessages, const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings)
 {
 	if (StageSettings.EntireClusterColorGrading.ColorGradingSettings.bOverride_AutoExposureBias)
 	{
@@ -79,98 +80,92 @@ void UValidation_Level_ICVFXConfig_ColorGrading::ValidateEntireClusterColorGradi
 	}
 }
 
-void UValidation_Level_ICVFXConfig_ColorGrading::ValidatePerViewPortColorGrading(
-	FValidationResult& Result, FString& ActorMessages, const FDisplayClusterConfigurationICVFX_StageSettings StageSettings) const
+void UValidation_Level_ICVFXConfig_ColorGrading::ValidatePerViewportColorGrading(
+	FValidationResult& Result, FString& ActorMessages, const int32 x,
+	const FDisplayClusterConfigurationViewport_PerViewportColorGrading& PerViewportColorGrading)
 {
-	for (int x=0; x<StageSettings.PerViewportColorGrading.Num(); x++)
-	{
-		TArray< FStringFormatArg > Args;
-		Args.Add( FStringFormatArg( x ) );
+	TArray< FStringFormatArg > Args;
+	Args.Add( FStringFormatArg( x ) );
 
-		if (StageSettings.PerViewportColorGrading[x].ColorGradingSettings.bOverride_AutoExposureBias)
-		{
-			if (StageSettings.PerViewportColorGrading[x].ColorGradingSettings.AutoExposureBias != 0.0)
-			{
-				Result.Result = EValidationStatus::Warning;
-				ActorMessages += FString::Format
-				(
-					TEXT( "PerViewportColorGrading {0} Exposure Compensation Enabled & Not 0.0 Could Be Ariststic Choice\n" ), Args
-				);
-				
-			}
-		}
-		
-		if (StageSettings.PerViewportColorGrading[x].ColorGradingSettings.Misc.bOverride_BlueCorrection)
+	if (PerViewportColorGrading.ColorGradingSettings.bOverride_AutoExposureBias)
+	{
+		if (PerViewportColorGrading.ColorGradingSettings.AutoExposureBias != 0.0)
 		{
-			Result.Result = EValidationStatus::Fail;
+			Result.Result = EValidationStatus::Warning;
 			ActorMessages += FString::Format
 			(
-				TEXT( "PerViewportColorGrading {0} Blue Correction Enabled\n" ), Args
+				TEXT( "PerViewportColorGrading {0} Exposure Compensation Enabled & Not 0.0 Could Be Ariststic Choice\n" ), Args
 			);
+			
 		}
+	}
+	
+	if (PerViewportColorGrading.ColorGradingSettings.Misc.bOverride_BlueCorrection)
+	{
+		Result.Result = EValidationStatus::Fail;
+		ActorMessages += FString::Format
+		(
+			TEXT( "PerViewportColorGrading {0} Blue Correction Enabled\n" ), Args
+		);
+	}
 
-		if (StageSettings.PerViewportColorGrading[x].ColorGradingSettings.Misc.BlueCorrection != 0.0)
-		{
-			Result.Result = EValidationStatus::Fail;
-			ActorMessages += FString::Format
-			(
-				TEXT( "PerViewportColorGrading {0} Blue Correction Not Set To 0.0\n" ), Args
-			);
-		}
+	if (PerViewportColorGrading.ColorGradingSettings.Misc.BlueCorrection != 0.0)
+	{
+		Result.Result = EValidationStatus::Fail;
+		ActorMessages += FString::Format
+		(
+			TEXT( "PerViewportColorGrading {0} Blue Correction Not Set To 0.0\n" ), Args
+		);
+	}
 
-		if (StageSettings.PerViewportColorGrading[x].ColorGradingSettings.Misc.bOverride_ExpandGamut)
-		{
-			Result.Result = EValidationStatus::Fail;
-			ActorMessages += FString::Format
-			(
-				TEXT( "PerViewportColorGrading {0} Expand Gamut Enabled\n" ), Args
-			);
-		}
+	if (PerViewportColorGrading.ColorGradingSettings.Misc.bOverride_ExpandGamut)
+	{
+		Result.Result = EValidationStatus::Fail;
+		ActorMessages += FString::Format
+		(
+			TEXT( "PerViewportColorGrading {0} Expand Gamut Enabled\n" ), Args
+		);
+	}
 
-		if (StageSettings.PerViewportColorGrading[x].ColorGradingSettings.Misc.ExpandGamut != 0.0)
-		{
-			Result.Result = EValidationStatus::Fail;
-			ActorMessages += FString::Format
-			(
-				TEXT( "PerViewportColorGrading {0} Expand Gamut Not Set To 0.0\n" ), Args
-			);
-		}
+	if (PerViewportColorGrading.ColorGradingSettings.Misc.ExpandGamut != 0.0)
+	{
+		Result.Result = EValidationStatus::Fail;
+		ActorMessages += FString::Format
+		(
+			TEXT( "PerViewportColorGrading {0} Expand Gamut Not Set To 0.0\n" ), Args
+		);
 	}
 }
 
 void UValidation_Level_ICVFXConfig_ColorGrading::ValidateInnerFrustumColorGrading(
-	FValidationResult& Result, FString& ActorMessages, const ADisplayClusterRootActor* Actor) const
+	FValidationResult& Result, FString& ActorMessages, const UDisplayClusterICVFXCameraComponent& IcvfxCameraComponent,
+	const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings)
 {
-	TInlineComponentArray<UDisplayClusterICVFXCameraComponent*> IcvfxCameraComponents;
-	Actor->GetComponents(IcvfxCameraComponents);
-	for (const UDisplayClusterICVFXCameraComponent* IcvfxCameraComponent : IcvfxCameraComponents)
-	{
-		const bool BlueCorrectionEnabled = IcvfxCameraComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.bOverride_BlueCorrection;
-		const float BlueCorrection = IcvfxCameraComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.BlueCorrection;
+	const bool BlueCorrectionEnabled = CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.bOverride_BlueCorrection;
+	const float BlueCorrection = CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.BlueCorrection;
 
-		const float ExpandGamutEnabled = IcvfxCameraComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.bOverride_ExpandGamut;
-		const float ExpandGamut = IcvfxCameraComponent->CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.ExpandGamut;
+	const float ExpandGamutEnabled = CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.bOverride_ExpandGamut;
+	const float ExpandGamut = CameraSettings.AllNodesColorGrading.ColorGradingSettings.Misc.ExpandGamut;
 
-		TArray< FStringFormatArg > Args;
-		Args.Add( FStringFormatArg( IcvfxCameraComponent->GetName() ) );
-			
-		if (BlueCorrectionEnabled && BlueCorrection != 0.0)
-		{
-			Result.Result = EValidationStatus::Fail;
-			ActorMessages += FString::Format(
-				TEXT("{0}\nBlue Correction Is Enabled For Inner Frustum Color Grading & Not Set To 0.0\n"),
-				Args
-			);
-		}
+	TArray< FStringFormatArg > Args;
+	Args.Add( FStringFormatArg( IcvfxCameraComponent.GetName() ) );
+		
+	if (BlueCorrectionEnabled && BlueCorrection != 0.0)
+	{
+		Result.Result = EValidationStatus::Fail;
+		ActorMessages += FString::Format(
+			TEXT("{0}\nBlue Correction Is Enabled For Inner Frustum Color Grading & Not Set To 0.0\n"),
+			Args
+		);
+	}
 
-		if (ExpandGamutEnabled && ExpandGamut != 0.0)
-		{
-			Result.Result = EValidationStatus::Fail;
-			ActorMessages += FString::Format(
-				TEXT("{0}\nExpand Gamut Is Enabled For Inner Frustum Color Grading & Not Set To 0.0\n"),
-				Args
-			);
-		}
+	if (ExpandGamutEnabled && ExpandGamut != 0.0)
+	{
+		Result.Result = EValidationStatus::Fail;
+		ActorMessages += FString::Format(
+			TEXT("{0}\nExpand Gamut Is Enabled For Inner Frustum Color Grading & Not Set To 0.0\n"),
+			Args
+		);
 	}
 }
 
@@ -293,6 +288,59 @@ void UValidation_Level_ICVFXConfig_ColorGrading::FixInnerFrustumColorGrading(
 	}
 }
 
+namespace ValidationICVFXConfigColorGrading
+{
+	/**
+	* Validates the color grading of every nDisplay root actor, collecting the messages of each root actor under its name
+	*/
+	class FColorGradingVisitor final : public FValidationICVFXConfigVisitor
+	{
+	public:
+		FColorGradingVisitor(FValidationResult& InValidationResult, FString& InMessage)
+			: ValidationResult(InValidationResult)
+			, Message(InMessage)
+		{
+		}
+
+	protected:
+		virtual void OnRootActorBegin(const ADisplayClusterRootActor& RootActor) override
+		{
+			ActorMessages.Reset();
+		}
+
+		virtual void OnRootActorEnd(const ADisplayClusterRootActor& RootActor) override
+		{
+			if (ActorMessages.Len())
+			{
+				Message +=  RootActor.GetName();
+				Message += "\n";
+				Message += ActorMessages;
+			}
+		}
+
+		virtual void OnStageSettings(const ADisplayClusterRootActor& RootActor, const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings) override
+		{
+			UValidation_Level_ICVFXConfig_ColorGrading::ValidateEntireClusterColorGrading(ValidationResult, ActorMessages, StageSettings);
+		}
+
+		virtual void OnPerViewportColorGrading(const ADisplayClusterRootActor& RootActor, const int32 ProfileIndex,
+			const FDisplayClusterConfigurationViewport_PerViewportColorGrading& ColorGrading) override
+		{
+			UValidation_Level_ICVFXConfig_ColorGrading::ValidatePerViewportColorGrading(ValidationResult, ActorMessages, ProfileIndex, ColorGrading);
+		}
+
+		virtual void OnICVFXCamera(const ADisplayClusterRootActor& RootActor, const UDisplayClusterICVFXCameraComponent& CameraComponent,
+			const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings) override
+		{
+			UValidation_Level_ICVFXConfig_ColorGrading::ValidateInnerFrustumColorGrading(ValidationResult, ActorMessages, CameraComponent, CameraSettings);
+		}
+
+	private:
+		FValidationResult& ValidationResult;
+		FString& Message;
+		FString ActorMessages;
+	};
+}
 #endif
 
 
@@ -303,28 +351,8 @@ FValidationResult UValidation_Level_ICVFXConfig_ColorGrading::Validation_Impleme
 	FString Message = "";
 	
 	const UWorld* World = GetCorrectValidationWorld();
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
-
-	for (AActor* FoundActor : FoundActors)
-	{
-		FString ActorMessages = "";
-		const ADisplayClusterRootActor* MyActor = Cast<ADisplayClusterRootActor>(FoundActor);
-		
-		const UDisplayClusterConfigurationData* ConfigData = MyActor->GetConfigData();
-		const FDisplayClusterConfigurationICVFX_StageSettings StageSettings = ConfigData->StageSettings;
-		ValidateEntireClusterColorGrading(ValidationResult, ActorMessages, StageSettings);
-		ValidatePerViewPortColorGrading(ValidationResult, ActorMessages, StageSettings);
-		ValidateInnerFrustumColorGrading(ValidationResult, ActorMessages, MyActor);
-		
-		if (ActorMessages.Len())
-		{
-			Message +=  MyActor->GetName();
-			Message += "\n";
-			Message += ActorMessages;
-		}
-		
-	}
+	ValidationICVFXConfigColorGrading::FColorGradingVisitor Visitor(ValidationResult, Message);
+	Visitor.Visit(World);
 
 	if (ValidationResult.Result != EValidationStatus::Pass)
 	{
@@ -350,7 +378,7 @@ FValidationFixResult UValidation_Level_ICVFXConfig_ColorGrading::Fix_Implementat
 	
 	const UWorld* World = GetCorrectValidationWorld();
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+	UValidationBPLibrary::GetAllActorsOfClassForValidation(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
 
 	for (AActor* FoundActor : FoundActors)
 	{
@@ -362,12 +390,10 @@ FValidationFixResult UValidation_Level_ICVFXConfig_ColorGrading::Fix_Implementat
 		GEngine->BeginTransaction(*ValidationUndoContextName(), FText::FromString(ValidationDescription), ConfigData);
 			ConfigData->Modify();
 
-			FDisplayClusterConfigurationICVFX_StageSettings StageSettings = ConfigData->StageSettings;
+			FDisplayClusterConfigurationICVFX_StageSettings& StageSettings = ConfigData->StageSettings;
 			FixEntireClusterColorGrading(ActorMessages, StageSettings);
 			FixPerViewportColorGrading(ActorMessages, StageSettings);
 			FixInnerFrustumColorGrading(ValidationFixResult, ActorMessages, MyActor);
-		
-			ConfigData->StageSettings = StageSettings;
 		GEngine->EndTransaction();
 		
 		if (ActorMessages.Len())
@@ -15,8 +15,8 @@ limitations under the License.
 */
 
 #include "Validation_Level_ICVFXConfig_RTTSettings.h"
-#include "Kismet/GameplayStatics.h"
-#if PLATFORM_WINDOWS
+#include "ValidationBPLibrary.h"
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
 #include "DisplayClusterRootActor.h"
 #include "CineCameraActor.h"
 #include "Components/DisplayClusterICVFXCameraComponent.h"
@@ -51,7 +51,7 @@ FValidationResult UValidation_Level_ICVFX_RTTSettings::Validation_Implementation
 	
 	const UWorld* World = GetCorrectValidationWorld();
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+	UValidationBPLibrary::GetAllActorsOfClassForValidation(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
 
 	for (AActor* FoundActor : FoundActors)
 	{
@@ -105,7 +105,7 @@ FValidationFixResult UValidation_Level_ICVFX_RTTSettings::Fix_Implementation()
 
 	const UWorld* World = GetCorrectValidationWorld();
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
+	UValidationBPLibrary::GetAllActorsOfClassForValidation(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
 
 	for (AActor* FoundActor : FoundActors)
 	{
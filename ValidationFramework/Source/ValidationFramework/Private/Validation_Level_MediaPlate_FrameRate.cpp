@@ -17,7 +17,6 @@ limitations under the License.
 #include "Validation_Level_MediaPlate_FrameRate.h"
 
 #include "MediaPlate.h"
-#include "Kismet/GameplayStatics.h"
 #include "MediaPlateComponent.h"
 #include "MediaSource.h"
 #include "MediaPlaylist.h"
@@ -38,6 +37,12 @@ UValidation_Level_MediaPlate_FrameRate::UValidation_Level_MediaPlate_FrameRate()
 		EValidationWorkflow::VRScouting,
 		EValidationWorkflow::SimulCam
 	};
+
+	// Walks the actors in the level so cannot inherit the thread safety of the DX12 validation
+	ValidationThreadSafety = EValidationThreadSafety::GameThread;
+	ValidationDependencies = {
+		UValidation_Project_DX12::StaticClass()
+	};
 }
 
 TArray<UImgMediaSource*> UValidation_Level_MediaPlate_FrameRate::GetAllMediaSourcesFromLevel() const
@@ -46,7 +51,7 @@ TArray<UImgMediaSource*> UValidation_Level_MediaPlate_FrameRate::GetAllMediaSour
 
 	TArray<UImgMediaSource*> ImgMediaSourceArray;
 	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, AMediaPlate::StaticClass(), FoundActors);
+	UValidationBPLibrary::GetAllActorsOfClassForValidation(World, AMediaPlate::StaticClass(), FoundActors);
 
 	for (AActor* FoundActor : FoundActors)
 	{
@@ -70,7 +75,7 @@ TArray<UImgMediaSource*> UValidation_Level_MediaPlate_FrameRate::GetAllMediaSour
 
 FValidationResult UValidation_Level_MediaPlate_FrameRate::Validation_Implementation()
 {
-	FValidationResult ValidationResult = UValidation_Project_DX12::Validation_Implementation();
+	FValidationResult ValidationResult = RunDependency(UValidation_Project_DX12::StaticClass());
 	FString Message = "";
 
 	if (ValidationResult.Result == EValidationStatus::Pass)
@@ -128,8 +133,8 @@ FValidationResult UValidation_Level_MediaPlate_FrameRate::Validation_Implementat
 
 FValidationFixResult UValidation_Level_MediaPlate_FrameRate::Fix_Implementation() 
 {
-	const FValidationResult ValidationResult = Validation_Implementation();
-	FValidationFixResult ValidationFixResult = UValidation_Project_DX12::Fix_Implementation();
+	const FValidationResult ValidationResult = RunValidation();
+	FValidationFixResult ValidationFixResult = RunDependencyFix(UValidation_Project_DX12::StaticClass());
 	
 
 	if (ValidationResult.Result  != EValidationStatus::Pass)
@@ -0,0 +1,401 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "Validation_Level_NDisplay_ColorPipeline.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "DisplayClusterRootActor.h"
+#include "DisplayClusterConfigurationTypes.h"
+#include "CineCameraComponent.h"
+#include "Components/DisplayClusterICVFXCameraComponent.h"
+#include "Engine/PostProcessVolume.h"
+#include "ValidationColorPipelineSimulator.h"
+#include "ValidationICVFXConfigVisitor.h"
+#include "ValidationOCIOResolver.h"
+#endif
+
+#include "ValidationBPLibrary.h"
+#include "VFProjectSettingsBase.h"
+
+
+UValidation_Level_NDisplay_ColorPipeline::UValidation_Level_NDisplay_ColorPipeline()
+{
+	ValidationName = "NDisplay - Color Pipeline Simulation";
+	ValidationDescription = "Simulates the color pipeline of every viewport and inner frustum of the nDisplay setups on "
+							"the CPU, from the post processing and color grading through to the OCIO transform, to "
+							"predict how far the output of each wall node strays from the level post processing followed "
+							"by the project OCIO transform";
+	FixDescription = "Requires a manual fix, the post processing, color grading and OCIO validations point to the "
+				  "settings which need to change";
+	ValidationScope = EValidationScope::Level;
+	ValidationApplicableWorkflows = {
+		EValidationWorkflow::ICVFX
+	};
+}
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+namespace ValidationNDisplayColorPipeline
+{
+	/**
+	* Applies the overridden members of nDisplay color grading settings to a grade
+	*/
+	template<typename TColorGradingSettings>
+	void ApplyColorGradingOverrides(FValidationColorGrade& Grade, const TColorGradingSettings& Settings)
+	{
+		if (Settings.bOverride_AutoExposureBias)
+		{
+			Grade.ExposureBias = Settings.AutoExposureBias;
+		}
+		if (Settings.Misc.bOverride_BlueCorrection)
+		{
+			Grade.BlueCorrection = Settings.Misc.BlueCorrection;
+		}
+		if (Settings.Misc.bOverride_ExpandGamut)
+		{
+			Grade.ExpandGamut = Settings.Misc.ExpandGamut;
+		}
+	}
+
+	/**
+	* Gets the enabled unbound post process volumes of the level, in the order of priority they are blended in
+	*/
+	TArray<const APostProcessVolume*> GetLevelVolumes(const UWorld* World)
+	{
+		TArray<AActor*> FoundActors;
+		UValidationBPLibrary::GetAllActorsOfClassForValidation(World, APostProcessVolume::StaticClass(), FoundActors);
+
+		TArray<const APostProcessVolume*> Volumes;
+		for (const AActor* FoundActor : FoundActors)
+		{
+			const APostProcessVolume* Volume = CastChecked<APostProcessVolume>(FoundActor);
+			if (Volume->bEnabled && Volume->bUnbound)
+			{
+				Volumes.Add(Volume);
+			}
+		}
+		Volumes.StableSort([](const APostProcessVolume& A, const APostProcessVolume& B) { return A.Priority < B.Priority; });
+		return Volumes;
+	}
+
+	/**
+	* Gets the grade of the level, the engine defaults overridden by the level post process volumes, optionally on top
+	* of the start post process of an nDisplay viewport which the volumes are blended over
+	*/
+	FValidationColorGrade GetLevelGrade(TConstArrayView<const APostProcessVolume*> Volumes, const FPostProcessSettings* StartSettings = nullptr)
+	{
+		FValidationColorGrade Grade = FValidationColorGrade::EngineDefault();
+		if (StartSettings != nullptr)
+		{
+			Grade.ApplyOverrides(*StartSettings);
+		}
+		for (const APostProcessVolume* Volume : Volumes)
+		{
+			Grade.ApplyOverrides(Volume->Settings);
+		}
+		return Grade;
+	}
+
+	/**
+	* Simulates every viewport of each cluster node and the inner frustum of each enabled ICVFX camera on each node,
+	* collecting the predicted deviation from the project OCIO transform under each root actor
+	*/
+	class FColorPipelineVisitor final : public FValidationICVFXConfigVisitor
+	{
+	public:
+		FColorPipelineVisitor(FValidationResult& InValidationResult, FValidationOCIOResolver& InOCIOResolver,
+			TConstArrayView<const APostProcessVolume*> InLevelVolumes, const FValidationColorGrade& InLevelGrade,
+			TConstArrayView<FLinearColor> InReferenceColors, const float InMaxDeltaE)
+			: ValidationResult(InValidationResult)
+			, OCIOResolver(InOCIOResolver)
+			, LevelVolumes(InLevelVolumes)
+			, LevelGrade(InLevelGrade)
+			, ReferenceColors(InReferenceColors)
+			, MaxDeltaE(InMaxDeltaE)
+		{
+		}
+
+	protected:
+		virtual void OnRootActorBegin(const ADisplayClusterRootActor& RootActor) override
+		{
+			StageSettings = nullptr;
+			NodeIds.Reset();
+			ActorMessages.Reset();
+		}
+
+		virtual void OnRootActorEnd(const ADisplayClusterRootActor& RootActor) override
+		{
+			if (ActorMessages.Len())
+			{
+				ValidationResult.Message += RootActor.GetName() + "\n" + ActorMessages;
+			}
+		}
+
+		virtual void OnStageSettings(const ADisplayClusterRootActor& RootActor, const FDisplayClusterConfigurationICVFX_StageSettings& InStageSettings) override
+		{
+			StageSettings = &InStageSettings;
+		}
+
+		virtual void OnClusterNode(const ADisplayClusterRootActor& RootActor, const FString& NodeId, const UDisplayClusterConfigurationClusterNode& ClusterNode) override
+		{
+			NodeIds.Add(NodeId);
+		}
+
+		virtual void OnViewport(const ADisplayClusterRootActor& RootActor, const FString& NodeId, const FString& ViewportId,
+			const UDisplayClusterConfigurationViewport& Viewport) override
+		{
+			// The start post process of the viewport is blended under the level volumes, the override post process
+			// over them and the final post process over everything including the nDisplay color grading
+			const FDisplayClusterConfigurationViewport_CustomPostprocess& CustomPostprocess = Viewport.RenderSettings.CustomPostprocess;
+			FValidationColorGrade Grade = CustomPostprocess.Start.bIsEnabled
+				? GetLevelGrade(LevelVolumes, &CustomPostprocess.Start.PostProcessSettings)
+				: LevelGrade;
+			if (CustomPostprocess.Override.bIsEnabled)
+			{
+				Grade.ApplyOverrides(CustomPostprocess.Override.PostProcessSettings);
+			}
+
+			if (StageSettings->EnableColorGrading)
+			{
+				TArray<const FDisplayClusterConfigurationViewport_PerViewportColorGrading*> ViewportGradings;
+				bool bEntireCluster = StageSettings->EntireClusterColorGrading.bEnableEntireClusterColorGrading;
+				for (const FDisplayClusterConfigurationViewport_PerViewportColorGrading& ColorGrading : StageSettings->PerViewportColorGrading)
+				{
+					if (ColorGrading.bIsEnabled && ColorGrading.ApplyPostProcessToObjects.Contains(ViewportId))
+					{
+						ViewportGradings.Add(&ColorGrading);
+						bEntireCluster &= ColorGrading.bIsEntireClusterEnabled;
+					}
+				}
+
+				if (bEntireCluster)
+				{
+					ApplyColorGradingOverrides(Grade, StageSettings->EntireClusterColorGrading.ColorGradingSettings);
+				}
+				for (const FDisplayClusterConfigurationViewport_PerViewportColorGrading* ColorGrading : ViewportGradings)
+				{
+					ApplyColorGradingOverrides(Grade, ColorGrading->ColorGradingSettings);
+				}
+			}
+
+			if (CustomPostprocess.Final.bIsEnabled)
+			{
+				Grade.ApplyOverrides(CustomPostprocess.Final.PostProcessSettings);
+			}
+
+			const FDisplayClusterConfigurationICVFX_ViewportOCIO& ViewportOCIO = StageSettings->ViewportOCIO;
+			const FOpenColorIOColorConversionSettings* OCIOSettings = ViewportOCIO.AllViewportsOCIOConfiguration.bIsEnabled
+				? &ViewportOCIO.AllViewportsOCIOConfiguration.ColorConfiguration
+				: nullptr;
+			for (const FDisplayClusterConfigurationOCIOProfile& Profile : ViewportOCIO.PerViewportOCIOProfiles)
+			{
+				if (Profile.bIsEnabled && Profile.ApplyOCIOToObjects.Contains(ViewportId))
+				{
+					OCIOSettings = &Profile.ColorConfiguration;
+				}
+			}
+
+			Report(NodeId + " -> " + ViewportId, Grade, OCIOSettings);
+		}
+
+		virtual void OnICVFXCamera(const ADisplayClusterRootActor& RootActor, const UDisplayClusterICVFXCameraComponent& CameraComponent,
+			const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings) override
+		{
+			if (!CameraSettings.bEnable)
+			{
+				return;
+			}
+
+			// The inner frustum renders through the cine camera, so its post process is blended over the level volumes
+			FValidationColorGrade CameraGrade = LevelGrade;
+			const UCineCameraComponent* CineCamera = CameraComponent.GetActualCineCameraComponent();
+			if (CameraSettings.RenderSettings.bUseCameraComponentPostprocess && CineCamera != nullptr
+				&& CineCamera->PostProcessBlendWeight > 0.f)
+			{
+				CameraGrade.ApplyOverrides(CineCamera->PostProcessSettings);
+			}
+
+			const FDisplayClusterConfigurationICVFX_CameraOCIO& CameraOCIO = CameraSettings.CameraOCIO;
+			const bool bColorGrading = CameraSettings.EnableInnerFrustumColorGrading;
+			const FDisplayClusterConfigurationViewport_AllNodesColorGrading& AllNodesColorGrading = CameraSettings.AllNodesColorGrading;
+			for (const FString& NodeId : NodeIds)
+			{
+				FValidationColorGrade Grade = CameraGrade;
+				if (bColorGrading)
+				{
+					TArray<const FDisplayClusterConfigurationViewport_PerNodeColorGrading*> NodeGradings;
+					bool bEntireCluster = StageSettings->EnableColorGrading
+						&& StageSettings->EntireClusterColorGrading.bEnableEntireClusterColorGrading
+						&& AllNodesColorGrading.bEnableEntireClusterColorGrading;
+					bool bAllNodes = AllNodesColorGrading.bEnableInnerFrustumAllNodesColorGrading;
+					for (const FDisplayClusterConfigurationViewport_PerNodeColorGrading& ColorGrading : CameraSettings.PerNodeColorGrading)
+					{
+						if (ColorGrading.bIsEnabled && ColorGrading.ApplyPostProcessToObjects.Contains(NodeId))
+						{
+							NodeGradings.Add(&ColorGrading);
+							bEntireCluster &= ColorGrading.bEntireClusterColorGrading;
+							bAllNodes &= ColorGrading.bAllNodesColorGrading;
+						}
+					}
+
+					if (bEntireCluster)
+					{
+						ApplyColorGradingOverrides(Grade, StageSettings->EntireClusterColorGrading.ColorGradingSettings);
+					}
+					if (bAllNodes)
+					{
+						ApplyColorGradingOverrides(Grade, AllNodesColorGrading.ColorGradingSettings);
+					}
+					for (const FDisplayClusterConfigurationViewport_PerNodeColorGrading* ColorGrading : NodeGradings)
+					{
+						ApplyColorGradingOverrides(Grade, ColorGrading->ColorGradingSettings);
+					}
+				}
+
+				const FOpenColorIOColorConversionSettings* OCIOSettings = CameraOCIO.AllNodesOCIOConfiguration.bIsEnabled
+					? &CameraOCIO.AllNodesOCIOConfiguration.ColorConfiguration
+					: nullptr;
+				for (const FDisplayClusterConfigurationOCIOProfile& Profile : CameraOCIO.PerNodeOCIOProfiles)
+				{
+					if (Profile.bIsEnabled && Profile.ApplyOCIOToObjects.Contains(NodeId))
+					{
+						OCIOSettings = &Profile.ColorConfiguration;
+					}
+				}
+
+				Report(NodeId + " -> " + CameraComponent.GetName() + " Inner Frustum", Grade, OCIOSettings);
+			}
+		}
+
+	private:
+		/**
+		* Simulates a single pipeline, or reuses the simulation of an identical pipeline, reporting it if its deviation
+		* is too large
+		*/
+		void Report(const FString& PipelineName, const FValidationColorGrade& Grade, const FOpenColorIOColorConversionSettings* OCIOSettings)
+		{
+			const int32 OCIOId = OCIOSettings ? OCIOResolver.Resolve(*OCIOSettings).Id : INDEX_NONE;
+			const TPair<FValidationColorGrade, int32> Key(Grade, OCIOId);
+
+			const FValidationOCIOColorDifference* Difference = Differences.Find(Key);
+			if (Difference == nullptr)
+			{
+				FValidationOCIOColorDifference NewDifference;
+				TArray<FLinearColor> Colors;
+				if (FValidationColorPipelineSimulator::Simulate(Grade, OCIOSettings, Colors))
+				{
+					NewDifference = FValidationOCIOEquivalence::CompareSamples(ReferenceColors, Colors);
+				}
+				Difference = &Differences.Add(Key, NewDifference);
+			}
+
+			if (!Difference->bEvaluated)
+			{
+				ValidationResult.Result = FMath::Min(ValidationResult.Result, EValidationStatus::Warning);
+				ActorMessages += PipelineName + " OCIO Config Could Not Be Evaluated To Simulate The Color Pipeline\n";
+			}
+			else if (Difference->MaxDeltaE > MaxDeltaE || Difference->NumNonFiniteSamples)
+			{
+				ValidationResult.Result = FMath::Min(ValidationResult.Result, EValidationStatus::Warning);
+				ActorMessages += FString::Printf(
+					TEXT("%s Predicted Output Deviates From The Project OCIO, Max Delta E %.3f At %s, Mean Delta E %.3f\n"),
+					*PipelineName, Difference->MaxDeltaE, *Difference->WorstSample.ToString(), Difference->MeanDeltaE);
+			}
+		}
+
+		FValidationResult& ValidationResult;
+		FValidationOCIOResolver& OCIOResolver;
+		TConstArrayView<const APostProcessVolume*> LevelVolumes;
+		const FValidationColorGrade& LevelGrade;
+		TConstArrayView<FLinearColor> ReferenceColors;
+		float MaxDeltaE;
+
+		const FDisplayClusterConfigurationICVFX_StageSettings* StageSettings = nullptr;
+		TArray<FString> NodeIds;
+		FString ActorMessages;
+		TMap<TPair<FValidationColorGrade, int32>, FValidationOCIOColorDifference> Differences;
+	};
+}
+#endif
+
+FValidationResult UValidation_Level_NDisplay_ColorPipeline::Validation_Implementation()
+{
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	FValidationResult ValidationResult = FValidationResult(EValidationStatus::Pass, "");
+
+	const TSharedRef<FValidationOCIOResolver> OCIOResolver = UValidationBPLibrary::GetOCIOResolver();
+	const FOpenColorIOColorConversionSettings* ProjectOCIOSettings = OCIOResolver->GetProjectSettings();
+	if (ProjectOCIOSettings == nullptr || !OCIOResolver->ResolveProjectSettings().bIsValid)
+	{
+		ValidationResult.Result = EValidationStatus::Warning;
+		ValidationResult.Message = "Validation Framework Project OCIO Config Is Not Set Or Not Valid\nUnable To Simulate The Color Pipeline";
+		return ValidationResult;
+	}
+
+	// The reference is the level grade followed by the project OCIO transform, so only the grading and OCIO which a
+	// viewport or wall node adds on top of the level is reported
+	const UWorld* World = GetCorrectValidationWorld();
+	const TArray<const APostProcessVolume*> LevelVolumes = ValidationNDisplayColorPipeline::GetLevelVolumes(World);
+	const FValidationColorGrade LevelGrade = ValidationNDisplayColorPipeline::GetLevelGrade(LevelVolumes);
+	TArray<FLinearColor> ReferenceColors;
+	if (!FValidationColorPipelineSimulator::Simulate(LevelGrade, ProjectOCIOSettings, ReferenceColors))
+	{
+		ValidationResult.Result = EValidationStatus::Warning;
+		ValidationResult.Message = "Validation Framework Project OCIO Config Could Not Be Evaluated\nUnable To Simulate The Color Pipeline";
+		return ValidationResult;
+	}
+
+	const UVFProjectSettingsBase* ProjectSettings = Cast<UVFProjectSettingsBase>(UValidationBPLibrary::GetValidationFrameworkProjectSettings());
+	const float MaxDeltaE = ProjectSettings ? ProjectSettings->MaxColorPipelineDeltaE : 1.f;
+
+	ValidationNDisplayColorPipeline::FColorPipelineVisitor Visitor(ValidationResult, *OCIOResolver, LevelVolumes, LevelGrade,
+		ReferenceColors, MaxDeltaE);
+	Visitor.Visit(World);
+
+	if (ValidationResult.Result == EValidationStatus::Pass)
+	{
+		ValidationResult.Message = "Valid";
+	}
+	return ValidationResult;
+#endif
+
+#if PLATFORM_MAC
+	FValidationResult ValidationResult = FValidationResult();
+	ValidationResult.Result = EValidationStatus::Warning;
+	ValidationResult.Message = "Ndisplay Validations Not Valid On OSX";
+	return ValidationResult;
+#endif
+}
+
+FValidationFixResult UValidation_Level_NDisplay_ColorPipeline::Fix_Implementation()
+{
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	FValidationFixResult ValidationFixResult = FValidationFixResult(EValidationFixStatus::Fixed, "Nothing To Fix");
+	const FValidationResult ValidationResult = RunValidation();
+	if (ValidationResult.Result != EValidationStatus::Pass)
+	{
+		ValidationFixResult.Result = EValidationFixStatus::ManualFix;
+		ValidationFixResult.Message = ValidationResult.Message;
+	}
+	return ValidationFixResult;
+#endif
+
+#if PLATFORM_MAC
+	FValidationFixResult ValidationFixResult = FValidationFixResult();
+	ValidationFixResult.Result = EValidationFixStatus::NotFixed;
+	ValidationFixResult.Message = "Ndisplay Validations Not Valid On OSX";
+	return ValidationFixResult;
+#endif
+}
@@ -35,11 +35,8 @@ FValidationResult UValidation_Level_NDisplay_Mesh_2UVChannels::Validation_Implem
 {
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels;
-	
-	FValidationResult Result =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult Result = UValidationBPLibrary::GetNDisplayMeshAnalysis(World)->Validate(
+		&UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels);
 
 	if (Result.Result == EValidationStatus::Fail)
 	{
@@ -63,11 +60,8 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_2UVChannels::Fix_Implementa
 	FValidationFixResult Result = FValidationFixResult(EValidationFixStatus::Fixed, "");
 	
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels;
-	
-	FValidationResult VResult =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult VResult = UValidationBPLibrary::GetNDisplayMeshAnalysis(World)->Validate(
+		&UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels);
 
 	if (VResult.Result != EValidationStatus::Pass)
 	{
@@ -86,15 +80,14 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_2UVChannels::Fix_Implementa
 #endif
 }
 
-EValidationStatus UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)
+EValidationStatus UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)
 {
-	const int NumUVChannels = StaticMesh->GetNumUVChannels(LodIndex);
+	const int NumUVChannels = MeshFacts.LODs[LodIndex].NumUVChannels;
 	if (NumUVChannels != 2)
 	{
-		Message = StaticMesh->GetPathName() + " LOD " + FString::FromInt(LodIndex) + " Has " + FString::FromInt(NumUVChannels) +" UV Channels Instead Of 2\n";
+		Message = MeshFacts.PathName + " LOD " + FString::FromInt(LodIndex) + " Has " + FString::FromInt(NumUVChannels) +" UV Channels Instead Of 2\n";
 		return EValidationStatus::Fail;
 	}
 
 	return EValidationStatus::Pass;
 }
-
@@ -16,12 +16,14 @@ limitations under the License.
 
 #include "Validation_Level_NDisplay_Mesh_FullPrecisionUVs.h"
 #include "ValidationBPLibrary.h"
+#include "VFProjectSettingsBase.h"
 
 
 UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::UValidation_Level_NDisplay_Mesh_FullPrecisionUVs()
 {
 	ValidationName = "NDisplay - Full Precision UVs";
-	ValidationDescription = "Any meshes which are being used to build nDisplay setups need to be imported into unreal with full precision UVs";
+	ValidationDescription = "Any meshes which are being used to build nDisplay setups need to be imported into unreal with full precision UVs. "
+							"When measured in the project settings, only where half precision UVs would visibly move the content";
 	FixDescription = "Artist will need to enable full precision UVs for any meshes which are part of nDisplay setups and reimport";
 	ValidationScope = EValidationScope::Level;
 	ValidationApplicableWorkflows = {
@@ -33,11 +35,7 @@ FValidationResult UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::Validation_I
 {
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateFullPrecisionUVs;
-	
-	FValidationResult Result =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult Result = ValidateNDisplayMeshes(World);
 	
 	return Result;
 #endif
@@ -56,11 +54,7 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::Fix_Imple
 	FValidationFixResult Result = FValidationFixResult(EValidationFixStatus::Fixed, "");
 	
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateFullPrecisionUVs;
-	
-	FValidationResult VResult =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult VResult = ValidateNDisplayMeshes(World);
 
 	if (VResult.Result != EValidationStatus::Pass)
 	{
@@ -79,14 +73,13 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::Fix_Imple
 }
 
 EValidationStatus UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateFullPrecisionUVs(
-	UStaticMesh* StaticMesh,
+	const FValidationMeshFacts& MeshFacts,
 	const int LodIndex,
 	FString& Message)
 {
-	const FStaticMeshSourceModel& LODModel = StaticMesh->GetSourceModel(LodIndex);
-	if (!LODModel.BuildSettings.bUseFullPrecisionUVs)
+	if (!MeshFacts.LODs[LodIndex].bUseFullPrecisionUVs)
 	{
-		FString ActorError = StaticMesh->GetPathName() + " Has Use Full PrecisionUVs For LOD " + FString::FromInt(LodIndex) +" Disabled - Manually Enable\n";
+		FString ActorError = MeshFacts.PathName + " Has Use Full PrecisionUVs For LOD " + FString::FromInt(LodIndex) +" Disabled - Manually Enable\n";
 		Message += ActorError;
 		return EValidationStatus::Fail;
 		
@@ -94,3 +87,53 @@ EValidationStatus UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateFull
 	return EValidationStatus::Pass;
 }
 
+EValidationStatus UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateHalfPrecisionUVError(
+	const FValidationMeshFacts& MeshFacts,
+	const int LodIndex,
+	const FIntPoint& ProcessorResolution,
+	const float MaxErrorTexels,
+	FString& Message)
+{
+	const FValidationMeshLODFacts& LODFacts = MeshFacts.LODs[LodIndex];
+	if (LODFacts.bUseFullPrecisionUVs)
+	{
+		return EValidationStatus::Pass;
+	}
+
+	if (LODFacts.UVHalfPrecisionErrors.IsEmpty())
+	{
+		return ValidateFullPrecisionUVs(MeshFacts, LodIndex, Message);
+	}
+
+	EValidationStatus Result = EValidationStatus::Pass;
+	for (int32 UV = 0; UV < LODFacts.UVHalfPrecisionErrors.Num(); UV++)
+	{
+		const FVector2f& Error = LODFacts.UVHalfPrecisionErrors[UV];
+		const float ErrorTexels = FMath::Max(Error.X * ProcessorResolution.X, Error.Y * ProcessorResolution.Y);
+		if (ErrorTexels > MaxErrorTexels)
+		{
+			Result = EValidationStatus::Fail;
+			Message += FString::Printf(TEXT("%s LOD %d Half Precision UVs In Channel %d Are Off By Up To %.3f Texels At %dx%d - Manually Enable Full Precision UVs\n"),
+				*MeshFacts.PathName, LodIndex, UV, ErrorTexels, ProcessorResolution.X, ProcessorResolution.Y);
+		}
+	}
+	return Result;
+}
+
+FValidationResult UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateNDisplayMeshes(const UWorld* World)
+{
+	const TSharedRef<const FValidationMeshAnalysis> MeshAnalysis = UValidationBPLibrary::GetNDisplayMeshAnalysis(World);
+
+	const UVFProjectSettingsBase* ProjectSettings = Cast<UVFProjectSettingsBase>(UValidationBPLibrary::GetValidationFrameworkProjectSettings());
+	if (ProjectSettings == nullptr || !ProjectSettings->bMeasureUVHalfPrecisionError)
+	{
+		return MeshAnalysis->Validate(&UValidation_Level_NDisplay_Mesh_FullPrecisionUVs::ValidateFullPrecisionUVs);
+	}
+
+	const FIntPoint ProcessorResolution = ProjectSettings->LEDProcessorResolution;
+	const float MaxErrorTexels = ProjectSettings->MaxUVHalfPrecisionErrorTexels;
+	return MeshAnalysis->Validate([&ProcessorResolution, MaxErrorTexels](const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)
+	{
+		return ValidateHalfPrecisionUVError(MeshFacts, LodIndex, ProcessorResolution, MaxErrorTexels, Message);
+	});
+}
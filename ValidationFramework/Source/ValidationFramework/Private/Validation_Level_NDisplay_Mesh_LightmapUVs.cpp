@@ -35,11 +35,8 @@ FValidationResult UValidation_Level_NDisplay_Mesh_LightmapUVs::Validation_Implem
 {
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_LightmapUVs::ValidateLightmapUVs;
-	
-	FValidationResult Result =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult Result = UValidationBPLibrary::GetNDisplayMeshAnalysis(World)->Validate(
+		&UValidation_Level_NDisplay_Mesh_LightmapUVs::ValidateLightmapUVs);
 	
 	return Result;
 #endif
@@ -58,11 +55,8 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_LightmapUVs::Fix_Implementa
 	FValidationFixResult Result = FValidationFixResult(EValidationFixStatus::Fixed, "");
 	
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_LightmapUVs::ValidateLightmapUVs;
-	
-	FValidationResult VResult =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult VResult = UValidationBPLibrary::GetNDisplayMeshAnalysis(World)->Validate(
+		&UValidation_Level_NDisplay_Mesh_LightmapUVs::ValidateLightmapUVs);
 
 	if (VResult.Result != EValidationStatus::Pass)
 	{
@@ -80,12 +74,11 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_LightmapUVs::Fix_Implementa
 #endif
 }
 
-EValidationStatus UValidation_Level_NDisplay_Mesh_LightmapUVs::ValidateLightmapUVs(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)
+EValidationStatus UValidation_Level_NDisplay_Mesh_LightmapUVs::ValidateLightmapUVs(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)
 {
-	const FStaticMeshSourceModel& LODModel = StaticMesh->GetSourceModel(LodIndex);
-	if (LODModel.BuildSettings.bGenerateLightmapUVs)
+	if (MeshFacts.LODs[LodIndex].bGenerateLightmapUVs)
 	{
-		Message = StaticMesh->GetPathName() + " LOD " + FString::FromInt(LodIndex) + " Has Lightmap UV Generation Enabled - Should Disable & Reimport\n";
+		Message = MeshFacts.PathName + " LOD " + FString::FromInt(LodIndex) + " Has Lightmap UV Generation Enabled - Should Disable & Reimport\n";
 		return EValidationStatus::Fail;
 	}
 
@@ -0,0 +1,130 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "Validation_Level_NDisplay_Mesh_UVLayout.h"
+
+#include "ValidationBPLibrary.h"
+#include "VFProjectSettingsBase.h"
+
+
+UValidation_Level_NDisplay_Mesh_UVLayout::UValidation_Level_NDisplay_Mesh_UVLayout()
+{
+	ValidationName = "NDisplay - Check UV Overlap";
+	ValidationDescription = "Any meshes which are being used to build nDisplay setups should not have overlapping or flipped UVs in the "
+							"UV channel nDisplay projects through. Overlapping UV islands display the same content in several places and "
+							"flipped triangles mirror it";
+	FixDescription = "No Fix available artists will need to reimport the meshes with non overlapping UVs";
+	ValidationScope = EValidationScope::Level;
+	ValidationApplicableWorkflows = {
+		EValidationWorkflow::ICVFX
+	};
+}
+
+FValidationResult UValidation_Level_NDisplay_Mesh_UVLayout::Validation_Implementation()
+{
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	const UWorld* World = GetCorrectValidationWorld();
+	FValidationResult Result = ValidateNDisplayMeshes(World);
+
+	return Result;
+#endif
+
+#if PLATFORM_MAC
+	FValidationResult ValidationResult = FValidationResult();
+	ValidationResult.Result = EValidationStatus::Warning;
+	ValidationResult.Message = "Ndisplay Validations Not Valid On OSX";
+	return ValidationResult;
+#endif
+}
+
+FValidationFixResult UValidation_Level_NDisplay_Mesh_UVLayout::Fix_Implementation()
+{
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	FValidationFixResult Result = FValidationFixResult(EValidationFixStatus::Fixed, "");
+
+	const UWorld* World = GetCorrectValidationWorld();
+	FValidationResult VResult = ValidateNDisplayMeshes(World);
+
+	if (VResult.Result != EValidationStatus::Pass)
+	{
+		Result.Result = EValidationFixStatus::ManualFix;
+		Result.Message = VResult.Message;
+	}
+	return Result;
+#endif
+
+#if PLATFORM_MAC
+	FValidationFixResult ValidationFixResult = FValidationFixResult();
+	ValidationFixResult.Result = EValidationFixStatus::NotFixed;
+	ValidationFixResult.Message = "Ndisplay Validations Not Valid On OSX";
+	return ValidationFixResult;
+#endif
+}
+
+EValidationStatus UValidation_Level_NDisplay_Mesh_UVLayout::ValidateUVLayout(const FValidationMeshFacts& MeshFacts, const int LodIndex,
+	const int32 UVChannel, const float MaxOverlapPercent, FString& Message)
+{
+	const FValidationMeshLODFacts& LODFacts = MeshFacts.LODs[LodIndex];
+	if (!LODFacts.bHasCPUUVs)
+	{
+		Message += MeshFacts.PathName + " LOD " + FString::FromInt(LodIndex) + " Has No CPU Accessible UVs To Validate\n";
+		return EValidationStatus::Warning;
+	}
+
+	if (!LODFacts.UVLayouts.IsValidIndex(UVChannel))
+	{
+		Message += FString::Printf(TEXT("%s LOD %d Has No UV Channel %d For nDisplay To Project Through\n"),
+			*MeshFacts.PathName, LodIndex, UVChannel);
+		return EValidationStatus::Fail;
+	}
+
+	EValidationStatus Result = EValidationStatus::Pass;
+	const FValidationUVLayoutFacts& Layout = LODFacts.UVLayouts[UVChannel];
+	if (Layout.OverlapArea * 100.0f > MaxOverlapPercent)
+	{
+		Result = EValidationStatus::Fail;
+		Message += FString::Printf(TEXT("%s LOD %d Has Overlapping UVs In Channel %d Covering %.3f%% Of UV Space Across %u Islands\n"),
+			*MeshFacts.PathName, LodIndex, UVChannel, Layout.OverlapArea * 100.0f, Layout.NumIslands);
+	}
+
+	if (Layout.NumFlippedTriangles > 0)
+	{
+		Result = EValidationStatus::Fail;
+		Message += FString::Printf(TEXT("%s LOD %d Has %u Of %u Triangles Flipped In UV Channel %d Across %u Islands\n"),
+			*MeshFacts.PathName, LodIndex, Layout.NumFlippedTriangles, LODFacts.NumTriangles, UVChannel, Layout.NumIslands);
+	}
+
+	return Result;
+}
+
+FValidationResult UValidation_Level_NDisplay_Mesh_UVLayout::ValidateNDisplayMeshes(const UWorld* World)
+{
+	const UVFProjectSettingsBase* ProjectSettings = Cast<UVFProjectSettingsBase>(UValidationBPLibrary::GetValidationFrameworkProjectSettings());
+	const int32 UVChannel = ProjectSettings != nullptr ? ProjectSettings->NDisplayProjectionUVChannel : 0;
+	const float MaxOverlapPercent = ProjectSettings != nullptr ? ProjectSettings->MaxUVOverlapPercent : 0.0f;
+	if (UVChannel < 0 || UVChannel >= static_cast<int32>(FValidationUVBounds::MaxChannels))
+	{
+		return FValidationResult(EValidationStatus::Fail, FString::Printf(
+			TEXT("The nDisplay Projection UV Channel %d In The Project Settings Is Not A Valid UV Channel"), UVChannel));
+	}
+
+	// Only the projection channel is analyzed, the layouts of the other channels are never read
+	const TSharedRef<const FValidationMeshAnalysis> MeshAnalysis = UValidationBPLibrary::GetNDisplayMeshAnalysis(World, 1u << UVChannel);
+	return MeshAnalysis->Validate([UVChannel, MaxOverlapPercent](const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)
+	{
+		return ValidateUVLayout(MeshFacts, LodIndex, UVChannel, MaxOverlapPercent, Message);
+	});
+}
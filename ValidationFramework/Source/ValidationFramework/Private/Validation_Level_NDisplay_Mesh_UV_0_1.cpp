@@ -36,11 +36,8 @@ FValidationResult UValidation_Level_NDisplay_Mesh_UV_0_1::Validation_Implementat
 {
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_UV_0_1::ValidateUVs;
-	
-	FValidationResult Result =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult Result = UValidationBPLibrary::GetNDisplayMeshAnalysis(World)->Validate(
+		&UValidation_Level_NDisplay_Mesh_UV_0_1::ValidateUVs);
 	
 	return Result;
 #endif
@@ -59,11 +56,8 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_UV_0_1::Fix_Implementation(
 	FValidationFixResult Result = FValidationFixResult(EValidationFixStatus::Fixed, "");
 	
 	const UWorld* World = GetCorrectValidationWorld();
-	const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> ProcessFunction =
-		&UValidation_Level_NDisplay_Mesh_UV_0_1::ValidateUVs;
-	
-	FValidationResult VResult =  UValidationBPLibrary::NDisplayMeshSettingsValidation(
-		World, ProcessFunction);
+	FValidationResult VResult = UValidationBPLibrary::GetNDisplayMeshAnalysis(World)->Validate(
+		&UValidation_Level_NDisplay_Mesh_UV_0_1::ValidateUVs);
 
 	if (VResult.Result != EValidationStatus::Pass)
 	{
@@ -81,34 +75,29 @@ FValidationFixResult UValidation_Level_NDisplay_Mesh_UV_0_1::Fix_Implementation(
 #endif
 }
 
-EValidationStatus UValidation_Level_NDisplay_Mesh_UV_0_1::ValidateUVs(UStaticMesh* StaticMesh, const int LodIndex,
+EValidationStatus UValidation_Level_NDisplay_Mesh_UV_0_1::ValidateUVs(const FValidationMeshFacts& MeshFacts, const int LodIndex,
 	FString& Message)
 {
+	const FValidationMeshLODFacts& LODFacts = MeshFacts.LODs[LodIndex];
+	if (!LODFacts.bHasCPUUVs)
+	{
+		Message += MeshFacts.PathName + " LOD " + FString::FromInt(LodIndex) + " Has No CPU Accessible UVs To Validate\n";
+		return EValidationStatus::Warning;
+	}
 
 	EValidationStatus Result = EValidationStatus::Pass;
-	const uint32 NumUVChannels = StaticMesh->GetNumUVChannels(LodIndex);
-	const FStaticMeshLODResources& LODResource = StaticMesh->GetRenderData()->LODResources[LodIndex];
-	const uint32 NumVerts = LODResource.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices();
-	for (uint32 UV = 0; UV < NumUVChannels; UV++)
+	for (int32 UV = 0; UV < LODFacts.UVBounds.Num(); UV++)
 	{
-		for (uint32 i = 0; i < NumVerts; i++)
+		const FValidationUVChannelBounds& Channel = LODFacts.UVBounds[UV];
+		if (Channel.NumOutOfRange == 0)
 		{
-
-			#if ENGINE_MAJOR_VERSION < 5
-				const FVector2D UVPosition = LODResource.VertexBuffers.StaticMeshVertexBuffer.GetVertexUV(i, UV);
-			#else
-				const FVector2f UVPosition = LODResource.VertexBuffers.StaticMeshVertexBuffer.GetVertexUV(i, UV);
-			#endif
-			
-			
-			if (UVPosition.X > 1 || UVPosition.X < 0 || UVPosition.Y > 1 || UVPosition.Y < 0)
-			{
-				Result = EValidationStatus::Fail;
-				Message += StaticMesh->GetPathName() + " LOD " + FString::FromInt(LodIndex) + " Has UVs In Channel " + FString::FromInt(UV) + " Outside 0-1 Space\n";
-				break;
-			}
-			
+			continue;
 		}
+
+		Result = EValidationStatus::Fail;
+		Message += FString::Printf(TEXT("%s LOD %d Has %u Of %u UVs In Channel %d Outside 0-1 Space, Bounds (%g, %g) To (%g, %g)\n"),
+			*MeshFacts.PathName, LodIndex, Channel.NumOutOfRange, LODFacts.NumVertices, UV,
+			Channel.Min.X, Channel.Min.Y, Channel.Max.X, Channel.Max.Y);
 	}
 
 	return Result;
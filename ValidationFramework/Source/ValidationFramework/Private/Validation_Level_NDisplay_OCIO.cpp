@@ -16,16 +16,17 @@ limitations under the License.
 
 
 #include "Validation_Level_NDisplay_OCIO.h"
-#include "Kismet/GameplayStatics.h"
 
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 #include "DisplayClusterRootActor.h"
 #include "DisplayClusterConfigurationTypes.h"
 #include "Components/DisplayClusterICVFXCameraComponent.h"
+#include "ValidationICVFXConfigVisitor.h"
+#include "ValidationNDisplayNameIndex.h"
 #endif
 
 #include "ValidationBPLibrary.h"
-#include "VFProjectSettingsBase.h"
+#include "ValidationOCIOResolver.h"
 
 
 
@@ -44,8 +45,8 @@ UValidation_Level_NDisplay_OCIO::UValidation_Level_NDisplay_OCIO()
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 void UValidation_Level_NDisplay_OCIO::ValidateOCIOColorConversionSettings(
 	FValidationResult& ValidationResult,
-	const FOpenColorIOColorConversionSettings OCIOSettings1,
-	FOpenColorIOColorConversionSettings OCIOSettings2, FString OCIOObjectName, bool HardFail
+	const FOpenColorIOColorConversionSettings& OCIOSettings1,
+	const FOpenColorIOColorConversionSettings& OCIOSettings2, const FString& OCIOObjectName, bool HardFail
 	)
 {
 
@@ -91,10 +92,52 @@ void UValidation_Level_NDisplay_OCIO::ValidateOCIOColorConversionSettings(
 	}
 }
 
+void UValidation_Level_NDisplay_OCIO::CompareOCIOColorConversionSettings(
+	FValidationResult& ValidationResult, FValidationOCIOResolver& OCIOResolver,
+	const FOpenColorIOColorConversionSettings& OCIOSettings1,
+	const FOpenColorIOColorConversionSettings& OCIOSettings2, const FString& OCIOObjectName, bool HardFail)
+{
+	const TOptional<float> MaxDeltaE = OCIOResolver.GetMaxNumericalDeltaE();
+	if (!MaxDeltaE.IsSet())
+	{
+		ValidateOCIOColorConversionSettings(ValidationResult, OCIOSettings1, OCIOSettings2, OCIOObjectName, HardFail);
+		return;
+	}
+
+	const FValidationOCIOColorDifference Difference = OCIOResolver.CompareNumerically(OCIOSettings1, OCIOSettings2);
+	if (!Difference.bEvaluated)
+	{
+		// Fall back to comparing by name when either transform can not be run on the CPU
+		ValidationResult.Message += OCIOObjectName + " OCIO Config Could Not Be Evaluated, Comparing By Name Instead\n";
+		ValidateOCIOColorConversionSettings(ValidationResult, OCIOSettings1, OCIOSettings2, OCIOObjectName, HardFail);
+		return;
+	}
+
+	if (Difference.MaxDeltaE <= MaxDeltaE.GetValue() && !Difference.NumNonFiniteSamples)
+	{
+		return;
+	}
+
+	const EValidationStatus Status = HardFail ? EValidationStatus::Fail : EValidationStatus::Warning;
+	if (ValidationResult.Result > Status)
+	{
+		ValidationResult.Result = Status;
+	}
+	ValidationResult.Message += OCIOObjectName + " Has A Different OCIO Transform To Those In The Validation Project Settings\n";
+	ValidationResult.Message += FString::Printf(
+		TEXT("Max Delta E %.3f At %s, Mean Delta E %.3f\n"),
+		Difference.MaxDeltaE, *Difference.WorstSample.ToString(), Difference.MeanDeltaE);
+	if (Difference.NumNonFiniteSamples)
+	{
+		ValidationResult.Message += FString::Printf(
+			TEXT("%d Colors Are Not Finite In Only One Of The Transforms\n"), Difference.NumNonFiniteSamples);
+	}
+}
+
 void UValidation_Level_NDisplay_OCIO::ValidateAllViewportOCIOSetups(
-	FValidationResult& ValidationResult,
-	const FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-	FString OCIOObjectName, const FDisplayClusterConfigurationICVFX_StageSettings StageSettings)
+	FValidationResult& ValidationResult, FValidationOCIOResolver& OCIOResolver,
+	const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	const FString& OCIOObjectName, const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings)
 {
 	
 	if (!StageSettings.ViewportOCIO.AllViewportsOCIOConfiguration.bIsEnabled)
@@ -103,95 +146,118 @@ void UValidation_Level_NDisplay_OCIO::ValidateAllViewportOCIOSetups(
 		ValidationResult.Message += OCIOObjectName +"\nUse OCIO Config For All Viewports Not Enabled\n";
 	}
 		
-	FOpenColorIOColorConversionSettings AllViewPortsOCIOSettings = StageSettings.
+	const FOpenColorIOColorConversionSettings& AllViewPortsOCIOSettings = StageSettings.
 		ViewportOCIO.
 		AllViewportsOCIOConfiguration.
 		ColorConfiguration;
 		
-	if (!AllViewPortsOCIOSettings.IsValid())
+	const FValidationOCIOResolution Resolution = OCIOResolver.Resolve(AllViewPortsOCIOSettings);
+	if (!Resolution.bIsValid)
 	{
 		ValidationResult.Result = EValidationStatus::Fail;
 		ValidationResult.Message += OCIOObjectName +"\nAll Viewports OCIO Config Asset, Is Not Set or Has Sources or Destinations Which Do Not Exist In The OCIO Config File\n";
 	
 	}
-	else
+	else if (Resolution.Id != OCIOResolver.Resolve(ProjectOCIOSettings).Id)
 	{
-		ValidateOCIOColorConversionSettings(
-			ValidationResult, ProjectOCIOSettings, AllViewPortsOCIOSettings, OCIOObjectName);
+		CompareOCIOColorConversionSettings(
+			ValidationResult, OCIOResolver, ProjectOCIOSettings, AllViewPortsOCIOSettings, OCIOObjectName);
 	}
 	
 		
 	
 }
 
-void UValidation_Level_NDisplay_OCIO::ValidatePerViewportOCIOOverrideSetups(
-	FValidationResult& ValidationResult, const FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-	FString OCIOObjectName, const FDisplayClusterConfigurationICVFX_StageSettings StageSettings)
+void UValidation_Level_NDisplay_OCIO::ValidatePerViewportOCIOOverrideSetup(
+	FValidationResult& ValidationResult, FValidationOCIOResolver& OCIOResolver,
+	const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	const FString& OCIOObjectName, const int32 Viewport_Idx, const FDisplayClusterConfigurationOCIOProfile& PerViewportOCIOProfile,
+	const FValidationNDisplayNameIndex& NameIndex, TMap<FString, int32>& ClaimedViewports)
 {
-	
-	for (int Viewport_Idx = 0; Viewport_Idx < StageSettings.ViewportOCIO.PerViewportOCIOProfiles.Num(); Viewport_Idx++)
+	if (PerViewportOCIOProfile.bIsEnabled)
 	{
-		
-		if (StageSettings.ViewportOCIO.PerViewportOCIOProfiles[Viewport_Idx].bIsEnabled)
+			
+		const FOpenColorIOColorConversionSettings& PerViewPortOCIOSettings = PerViewportOCIOProfile.ColorConfiguration;
+
+		const FValidationOCIOResolution Resolution = OCIOResolver.Resolve(PerViewPortOCIOSettings);
+		if (!Resolution.bIsValid)
 		{
 				
-			FOpenColorIOColorConversionSettings PerViewPortOCIOSettings = StageSettings.ViewportOCIO.
-			                                                              PerViewportOCIOProfiles[Viewport_Idx].
-			                                                              ColorConfiguration;
+			ValidationResult.Result = EValidationStatus::Fail;
+			ValidationResult.Message += OCIOObjectName +"\nPer Viewports OCIO Config Index " +
+				FString::FromInt(Viewport_Idx) + 
+				" Asset, Is Not Set or Has Sources or Destinations Which Do Not Exist In The OCIO Config File\n";
 
-			if (!PerViewPortOCIOSettings.IsValid())
-			{
-					
-				ValidationResult.Result = EValidationStatus::Fail;
-				ValidationResult.Message += OCIOObjectName +"\nPer Viewports OCIO Config Index " +
-					FString::FromInt(Viewport_Idx) + 
-					" Asset, Is Not Set or Has Sources or Destinations Which Do Not Exist In The OCIO Config File\n";
-	
-			}
-			else
-			{
-				ValidateOCIOColorConversionSettings(ValidationResult, ProjectOCIOSettings,
-					PerViewPortOCIOSettings, OCIOObjectName, false);
-			}
+		}
+		else if (Resolution.Id != OCIOResolver.Resolve(ProjectOCIOSettings).Id)
+		{
+			CompareOCIOColorConversionSettings(ValidationResult, OCIOResolver, ProjectOCIOSettings,
+				PerViewPortOCIOSettings, OCIOObjectName, false);
+		}
+
+		if (!PerViewportOCIOProfile.ApplyOCIOToObjects.Num())
+		{
+			ValidationResult.Result = EValidationStatus::Warning;
+			ValidationResult.Message += "\nPer Viewports OCIO Config Index " + FString::FromInt(Viewport_Idx) + " Is Applied No Viewports Are Set To Be Applied Too";
 
-			if (!StageSettings.ViewportOCIO.PerViewportOCIOProfiles[Viewport_Idx].ApplyOCIOToObjects.Num())
+		}
+		
+		for (int PerViewPortOCIO_Idx = 0; PerViewPortOCIO_Idx < PerViewportOCIOProfile.ApplyOCIOToObjects.Num(); PerViewPortOCIO_Idx++)
+		{
+			const FString& ViewportName = PerViewportOCIOProfile.ApplyOCIOToObjects[PerViewPortOCIO_Idx];
+			if (ViewportName.IsEmpty())
 			{
 				ValidationResult.Result = EValidationStatus::Warning;
-				ValidationResult.Message += "\nPer Viewports OCIO Config Index " + FString::FromInt(Viewport_Idx) + " Is Applied No Viewports Are Set To Be Applied Too";
+				ValidationResult.Message += "\nPer Viewports OCIO Config Index " + FString::FromInt(Viewport_Idx) + " Is Applied But Viewport " + FString::FromInt(PerViewPortOCIO_Idx) + " Is Not Sepcified";
 
 			}
-			
-			for (int PerViewPortOCIO_Idx = 0; PerViewPortOCIO_Idx < StageSettings.ViewportOCIO.PerViewportOCIOProfiles[Viewport_Idx].ApplyOCIOToObjects.Num(); PerViewPortOCIO_Idx++)
+			else if (!NameIndex.HasViewport(ViewportName))
 			{
-				FString ViewportName = StageSettings.ViewportOCIO.PerViewportOCIOProfiles[Viewport_Idx].ApplyOCIOToObjects[PerViewPortOCIO_Idx];
-				if (ViewportName.IsEmpty())
+				ValidationResult.Result = EValidationStatus::Fail;
+				ValidationResult.Message += OCIOObjectName + "\nPer Viewports OCIO Config Index " + FString::FromInt(Viewport_Idx) +
+					" Is Applied To Viewport " + ViewportName + " Which Does Not Exist";
+				const FString Suggestion = NameIndex.SuggestViewport(ViewportName);
+				if (!Suggestion.IsEmpty())
 				{
-					ValidationResult.Result = EValidationStatus::Warning;
-					ValidationResult.Message += "\nPer Viewports OCIO Config Index " + FString::FromInt(Viewport_Idx) + " Is Applied But Viewport " + FString::FromInt(PerViewPortOCIO_Idx) + " Is Not Sepcified";
-
+					ValidationResult.Message += ", Did You Mean " + Suggestion;
+				}
+				ValidationResult.Message += "\n";
+			}
+			else
+			{
+				const int32 ClaimingProfile = ClaimedViewports.FindOrAdd(ViewportName, Viewport_Idx);
+				if (ClaimingProfile != Viewport_Idx)
+				{
+					if (ValidationResult.Result > EValidationStatus::Warning)
+					{
+						ValidationResult.Result = EValidationStatus::Warning;
+					}
+					ValidationResult.Message += OCIOObjectName + "\nPer Viewports OCIO Config Index " + FString::FromInt(ClaimingProfile) +
+						" And " + FString::FromInt(Viewport_Idx) + " Are Both Applied To Viewport " + ViewportName + "\n";
 				}
+			}
 
-			}		
+		}		
 
-		}
-		else
+	}
+	else
+	{
+		if (ValidationResult.Result > EValidationStatus::Warning)
 		{
-			if (ValidationResult.Result > EValidationStatus::Warning)
-			{
-				ValidationResult.Result = EValidationStatus::Warning;
-			}
-			ValidationResult.Message += OCIOObjectName +"\nPer Viewports OCIO Config Index " +
-				FString::FromInt(Viewport_Idx) + 
-				" Exists But Not Enabled\n";
-				
+			ValidationResult.Result = EValidationStatus::Warning;
 		}
+		ValidationResult.Message += OCIOObjectName +"\nPer Viewports OCIO Config Index " +
+			FString::FromInt(Viewport_Idx) + 
+			" Exists But Not Enabled\n";
+			
 	}
 	
 }
 
 void UValidation_Level_NDisplay_OCIO::ValidateInnerFrustumOCIOSetups(
-	FValidationResult& ValidationResult, const FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-	FString ComponentName, FDisplayClusterConfigurationICVFX_CameraSettings Icvfx_CameraSettings)
+	FValidationResult& ValidationResult, FValidationOCIOResolver& OCIOResolver,
+	const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	const FString& ComponentName, const FDisplayClusterConfigurationICVFX_CameraSettings& Icvfx_CameraSettings)
 {
 	
 	if (!Icvfx_CameraSettings.CameraOCIO.AllNodesOCIOConfiguration.bIsEnabled)
@@ -199,98 +265,187 @@ void UValidation_Level_NDisplay_OCIO::ValidateInnerFrustumOCIOSetups(
 		ValidationResult.Result = EValidationStatus::Fail;
 		ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Is Not Enabled\n";
 	}
-	FOpenColorIOColorConversionSettings InnerFrustumOCIOConfig = Icvfx_CameraSettings
+	const FOpenColorIOColorConversionSettings& InnerFrustumOCIOConfig = Icvfx_CameraSettings
 		.CameraOCIO
 		.AllNodesOCIOConfiguration
 		.ColorConfiguration;
 			
-	if (!InnerFrustumOCIOConfig.IsValid())
+	const FValidationOCIOResolution Resolution = OCIOResolver.Resolve(InnerFrustumOCIOConfig);
+	if (!Resolution.bIsValid)
 	{
 		ValidationResult.Result = EValidationStatus::Fail;
 		ValidationResult.Message += ComponentName +"\nInner Frustum OCIO Config Asset, Is Not Set or Has Sources or Destinations Which Do Not Exist In The OCIO Config File\n";
 	
 	}
-	else
+	else if (Resolution.Id != OCIOResolver.Resolve(ProjectOCIOSettings).Id)
 	{
-		ValidateOCIOColorConversionSettings(ValidationResult, ProjectOCIOSettings,
+		CompareOCIOColorConversionSettings(ValidationResult, OCIOResolver, ProjectOCIOSettings,
 			InnerFrustumOCIOConfig, ComponentName);
 	}
 	
 }
 
-void UValidation_Level_NDisplay_OCIO::ValidateInnerFrustumOCIOPerNodeSetups(
-	FValidationResult& ValidationResult,
-	const FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-	FString ComponentName, FDisplayClusterConfigurationICVFX_CameraSettings Icvfx_CameraSettings)
+void UValidation_Level_NDisplay_OCIO::ValidateInnerFrustumOCIOPerNodeSetup(
+	FValidationResult& ValidationResult, FValidationOCIOResolver& OCIOResolver,
+	const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	const FString& ComponentName, const int32 PerNodeIndex, const FDisplayClusterConfigurationOCIOProfile& PerNodeOCIOProfile,
+	const FValidationNDisplayNameIndex& NameIndex, TMap<FString, int32>& ClaimedNodes)
 {
-	
-	for (int PerNodeIndex = 0; PerNodeIndex < Icvfx_CameraSettings.CameraOCIO.PerNodeOCIOProfiles.Num(); PerNodeIndex++)
+	if(!PerNodeOCIOProfile.bIsEnabled)
 	{
-		if(!Icvfx_CameraSettings.CameraOCIO.PerNodeOCIOProfiles[PerNodeIndex].bIsEnabled)
+		if(ValidationResult.Result > EValidationStatus::Warning)
 		{
-			if(ValidationResult.Result > EValidationStatus::Warning)
-			{
-				ValidationResult.Result = EValidationStatus::Warning;	
-			}
+			ValidationResult.Result = EValidationStatus::Warning;	
+		}
+		ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Per Node Config " +
+			FString::FromInt(PerNodeIndex) + 
+			" Exists But Is Not Enabled\n";
+
+	}
+	else
+	{
+		
+		int Result = PerNodeOCIOProfile.ApplyOCIOToObjects.Num();
+		if (!Result)
+		{
+			ValidationResult.Result = EValidationStatus::Warning;
 			ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Per Node Config " +
-				FString::FromInt(PerNodeIndex) + 
-				" Exists But Is Not Enabled\n";
+				FString::FromInt(PerNodeIndex) +
+				" Exists But Has No Viewports Applied\n";
 
 		}
-		else
+
+		for (int PerViewport_Idx = 0; PerViewport_Idx < PerNodeOCIOProfile.ApplyOCIOToObjects.Num(); PerViewport_Idx++)
 		{
-			
-			int Result = Icvfx_CameraSettings.CameraOCIO.PerNodeOCIOProfiles[PerNodeIndex].ApplyOCIOToObjects.Num();
-			if (!Result)
+			const FString& ViewportName = PerNodeOCIOProfile.ApplyOCIOToObjects[PerViewport_Idx];
+			if (ViewportName.IsEmpty())
 			{
+				
 				ValidationResult.Result = EValidationStatus::Warning;
 				ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Per Node Config " +
 					FString::FromInt(PerNodeIndex) +
-					" Exists But Has No Viewports Applied\n";
+					" Exists But, Node " + FString::FromInt(PerViewport_Idx) + " Has No Viewports Applied\n";
 
 			}
-
-			for (int PerViewport_Idx = 0; PerViewport_Idx < Icvfx_CameraSettings.CameraOCIO.PerNodeOCIOProfiles[PerNodeIndex].ApplyOCIOToObjects.Num(); PerViewport_Idx++)
+			else if (!NameIndex.HasNode(ViewportName))
 			{
-				FString ViewportName = Icvfx_CameraSettings.CameraOCIO.PerNodeOCIOProfiles[PerNodeIndex].ApplyOCIOToObjects[PerViewport_Idx];
-				if (ViewportName.IsEmpty())
+				ValidationResult.Result = EValidationStatus::Fail;
+				ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Per Node Config " + FString::FromInt(PerNodeIndex) +
+					" Is Applied To Node " + ViewportName + " Which Does Not Exist";
+				const FString Suggestion = NameIndex.SuggestNode(ViewportName);
+				if (!Suggestion.IsEmpty())
 				{
-					
-					ValidationResult.Result = EValidationStatus::Warning;
-					ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Per Node Config " +
-						FString::FromInt(PerNodeIndex) +
-						" Exists But, Node " + FString::FromInt(PerViewport_Idx) + " Has No Viewports Applied\n";
-
+					ValidationResult.Message += ", Did You Mean " + Suggestion;
+				}
+				ValidationResult.Message += "\n";
+			}
+			else
+			{
+				const int32 ClaimingProfile = ClaimedNodes.FindOrAdd(ViewportName, PerNodeIndex);
+				if (ClaimingProfile != PerNodeIndex)
+				{
+					if (ValidationResult.Result > EValidationStatus::Warning)
+					{
+						ValidationResult.Result = EValidationStatus::Warning;
+					}
+					ValidationResult.Message += ComponentName + "\nInner Frustum OCIO Per Node Configs " + FString::FromInt(ClaimingProfile) +
+						" And " + FString::FromInt(PerNodeIndex) + " Are Both Applied To Node " + ViewportName + "\n";
 				}
-
 			}
 
-			FOpenColorIOColorConversionSettings InnerFrustumPerNodeOCIOConfig = Icvfx_CameraSettings
-			.CameraOCIO
-			.PerNodeOCIOProfiles[PerNodeIndex]
-			.ColorConfiguration;
+		}
+
+		const FOpenColorIOColorConversionSettings& InnerFrustumPerNodeOCIOConfig = PerNodeOCIOProfile.ColorConfiguration;
+
+		const FValidationOCIOResolution Resolution = OCIOResolver.Resolve(InnerFrustumPerNodeOCIOConfig);
+		if (!Resolution.bIsValid)
+		{
+			ValidationResult.Result = EValidationStatus::Fail;
+			ValidationResult.Message += ComponentName +"\nInner Frustum OCIO Per Node Config "
+				+ FString::FromInt(PerNodeIndex)
+				+ ", Asset Is Not Set or Has Sources or Destinations Which Do Not Exist In The OCIO Config File\n";
+
+		}
+		else if (Resolution.Id != OCIOResolver.Resolve(ProjectOCIOSettings).Id)
+		{
+			CompareOCIOColorConversionSettings(
+			ValidationResult, OCIOResolver,
+			ProjectOCIOSettings,
+			InnerFrustumPerNodeOCIOConfig,
+			ComponentName, false);
+		}
+	}
+
+}
+
+namespace ValidationNDisplayOCIO
+{
+	/**
+	* Validates the OCIO setup of every nDisplay root actor against the project OCIO settings, skipping the ICVFX cameras
+	* which are not enabled
+	*/
+	class FOCIOVisitor final : public FValidationICVFXConfigVisitor
+	{
+	public:
+		FOCIOVisitor(FValidationResult& InValidationResult, FValidationOCIOResolver& InOCIOResolver,
+			const FOpenColorIOColorConversionSettings& InProjectOCIOSettings)
+			: ValidationResult(InValidationResult)
+			, OCIOResolver(InOCIOResolver)
+			, ProjectOCIOSettings(InProjectOCIOSettings)
+		{
+		}
+
+	protected:
+		virtual void OnRootActorBegin(const ADisplayClusterRootActor& RootActor) override
+		{
+			ActorName = RootActor.GetName();
+			const UDisplayClusterConfigurationData* ConfigData = RootActor.GetConfigData();
+			NameIndex = ConfigData ? FValidationNDisplayNameIndex(*ConfigData) : FValidationNDisplayNameIndex();
+			ClaimedViewports.Reset();
+		}
+
+		virtual void OnStageSettings(const ADisplayClusterRootActor& RootActor, const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings) override
+		{
+			UValidation_Level_NDisplay_OCIO::ValidateAllViewportOCIOSetups(ValidationResult, OCIOResolver, ProjectOCIOSettings, ActorName, StageSettings);
+		}
+
+		virtual void OnPerViewportOCIOProfile(const ADisplayClusterRootActor& RootActor, const int32 ProfileIndex, const FDisplayClusterConfigurationOCIOProfile& Profile) override
+		{
+			UValidation_Level_NDisplay_OCIO::ValidatePerViewportOCIOOverrideSetup(ValidationResult, OCIOResolver, ProjectOCIOSettings, ActorName, ProfileIndex, Profile,
+				NameIndex, ClaimedViewports);
+		}
 
-			if (!InnerFrustumPerNodeOCIOConfig.IsValid())
+		virtual void OnICVFXCamera(const ADisplayClusterRootActor& RootActor, const UDisplayClusterICVFXCameraComponent& CameraComponent,
+			const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings) override
+		{
+			if (CameraSettings.bEnable)
 			{
-				ValidationResult.Result = EValidationStatus::Fail;
-				ValidationResult.Message += ComponentName +"\nInner Frustum OCIO Per Node Config "
-					+ FString::FromInt(PerNodeIndex)
-					+ ", Asset Is Not Set or Has Sources or Destinations Which Do Not Exist In The OCIO Config File\n";
-	
+				ComponentName = ActorName + " -> " + CameraComponent.GetName();
+				ClaimedNodes.Reset();
+				UValidation_Level_NDisplay_OCIO::ValidateInnerFrustumOCIOSetups(ValidationResult, OCIOResolver, ProjectOCIOSettings, ComponentName, CameraSettings);
 			}
-			else
+		}
+
+		virtual void OnPerNodeOCIOProfile(const ADisplayClusterRootActor& RootActor, const UDisplayClusterICVFXCameraComponent& CameraComponent,
+			const int32 ProfileIndex, const FDisplayClusterConfigurationOCIOProfile& Profile) override
+		{
+			if (CameraComponent.CameraSettings.bEnable)
 			{
-				ValidateOCIOColorConversionSettings(
-				ValidationResult,
-				ProjectOCIOSettings,
-				InnerFrustumPerNodeOCIOConfig,
-				ComponentName, false);
+				UValidation_Level_NDisplay_OCIO::ValidateInnerFrustumOCIOPerNodeSetup(ValidationResult, OCIOResolver, ProjectOCIOSettings, ComponentName, ProfileIndex, Profile,
+					NameIndex, ClaimedNodes);
 			}
 		}
-		
-	}
-
 
+	private:
+		FValidationResult& ValidationResult;
+		FValidationOCIOResolver& OCIOResolver;
+		const FOpenColorIOColorConversionSettings& ProjectOCIOSettings;
+		FString ActorName;
+		FString ComponentName;
+		FValidationNDisplayNameIndex NameIndex;
+		TMap<FString, int32> ClaimedViewports;
+		TMap<FString, int32> ClaimedNodes;
+	};
 }
 #endif
 
@@ -298,20 +453,18 @@ FValidationResult UValidation_Level_NDisplay_OCIO::Validation_Implementation()
 {
 	FValidationResult ValidationResult = FValidationResult(EValidationStatus::Pass, "");
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
-	// Ensure we have validation framework settings configured in the project before continuing
-	// TODO: Refactor into function as used in a number of places
-	UObject* Settings = UValidationBPLibrary::GetValidationFrameworkProjectSettings();
-	if (Settings == nullptr)
+	// Ensure we have validation framework settings configured in the project before continuing, the project settings
+	// are only read and resolved once per run
+	const TSharedRef<FValidationOCIOResolver> OCIOResolver = UValidationBPLibrary::GetOCIOResolver();
+	const FOpenColorIOColorConversionSettings* ProjectOCIOSettings = OCIOResolver->GetProjectSettings();
+	if (ProjectOCIOSettings == nullptr)
 	{
 		ValidationResult.Result = EValidationStatus::Fail;
 		ValidationResult.Message += "\nNo Validation Framework Settings In Project";
 		return ValidationResult;
 	}
 
-	const UVFProjectSettingsBase* ProjectSettings = Cast<UVFProjectSettingsBase>(Settings);
-	const FOpenColorIOColorConversionSettings ProjectOCIOSettings = ProjectSettings->ProjectOpenIOColorConfig;
-
-	if (!ProjectOCIOSettings.IsValid())
+	if (!OCIOResolver->ResolveProjectSettings().bIsValid)
 	{
 		ValidationResult.Result = EValidationStatus::Fail;
 		ValidationResult.Message += "\nValidation Framework Project OCIO Config Asset Is Not Set, or Has Sources or "
@@ -321,30 +474,8 @@ FValidationResult UValidation_Level_NDisplay_OCIO::Validation_Implementation()
 	}
 	
 	const UWorld* World = GetCorrectValidationWorld();
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(World, ADisplayClusterRootActor::StaticClass(), FoundActors);
-	for (AActor* FoundActor : FoundActors)
-	{
-		const ADisplayClusterRootActor* MyActor = Cast<ADisplayClusterRootActor>(FoundActor);
-		const UDisplayClusterConfigurationData* ConfigData = MyActor->GetConfigData();
-		const FDisplayClusterConfigurationICVFX_StageSettings StageSettings = ConfigData->StageSettings;
-		ValidateAllViewportOCIOSetups(ValidationResult, ProjectOCIOSettings, FoundActor->GetName(), StageSettings);
-		ValidatePerViewportOCIOOverrideSetups(ValidationResult, ProjectOCIOSettings, FoundActor->GetName(), StageSettings);
-		
-		TInlineComponentArray<UDisplayClusterICVFXCameraComponent*> IcvfxCameraComponents;
-		MyActor->GetComponents(IcvfxCameraComponents);
-		for (const UDisplayClusterICVFXCameraComponent* IcvfxCameraComponent : IcvfxCameraComponents)
-		{
-
-			FDisplayClusterConfigurationICVFX_CameraSettings Icvfx_CameraSettings = IcvfxCameraComponent->GetCameraSettingsICVFX();
-			if(Icvfx_CameraSettings.bEnable)
-			{
-				const FString ComponentName = FoundActor->GetName() + " -> " + IcvfxCameraComponent->GetName(); 
-				ValidateInnerFrustumOCIOSetups(ValidationResult, ProjectOCIOSettings, ComponentName,Icvfx_CameraSettings);
-				ValidateInnerFrustumOCIOPerNodeSetups(ValidationResult, ProjectOCIOSettings, ComponentName,Icvfx_CameraSettings);
-			}
-		}
-	}
+	ValidationNDisplayOCIO::FOCIOVisitor Visitor(ValidationResult, *OCIOResolver, *ProjectOCIOSettings);
+	Visitor.Visit(World);
 
 	if (ValidationResult.Result ==  EValidationStatus::Pass)
 	{
@@ -363,7 +494,7 @@ FValidationFixResult UValidation_Level_NDisplay_OCIO::Fix_Implementation()
 
 	FValidationFixResult ValidationFixResult = FValidationFixResult();
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
-	FValidationResult ValidationResult = Validation_Implementation();
+	FValidationResult ValidationResult = RunValidation();
 	if (ValidationResult.Result == EValidationStatus::Pass)
 	{
 		ValidationFixResult.Result = EValidationFixStatus::Fixed;
@@ -29,6 +29,7 @@ UValidation_PP_Project_Exposure::UValidation_PP_Project_Exposure()
 	ValidationApplicableWorkflows = {
 		EValidationWorkflow::ICVFX
 	};
+	ValidationThreadSafety = EValidationThreadSafety::AnyThread;
 }
 
 FValidationResult UValidation_PP_Project_Exposure::Validation_Implementation()
@@ -30,6 +30,7 @@ UValidation_PP_Project_WorkingColorSpace::UValidation_PP_Project_WorkingColorSpa
 		EValidationWorkflow::ICVFX,
 		EValidationWorkflow::VAD
 	};
+	ValidationThreadSafety = EValidationThreadSafety::AnyThread;
 }
 
 FValidationResult UValidation_PP_Project_WorkingColorSpace::Validation_Implementation()
@@ -57,7 +58,7 @@ FValidationFixResult UValidation_PP_Project_WorkingColorSpace::Fix_Implementatio
 {
 	FValidationFixResult FixResult = FValidationFixResult(EValidationFixStatus::Fixed, "");
 
-	FValidationResult Result = Validation_Implementation();
+	FValidationResult Result = RunValidation();
 	if (Result.Result != EValidationStatus::Pass)
 	{
 		FixResult.Result = EValidationFixStatus::ManualFix;
@@ -29,6 +29,7 @@ UValidation_Project_DX12::UValidation_Project_DX12()
 	ValidationApplicableWorkflows = {
 		EValidationWorkflow::ICVFX
 	};
+	ValidationThreadSafety = EValidationThreadSafety::AnyThread;
 }
 
 FValidationResult UValidation_Project_DX12::Validation_Implementation()
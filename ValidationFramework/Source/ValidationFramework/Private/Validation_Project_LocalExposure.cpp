@@ -29,6 +29,7 @@ UValidation_Project_LocalExposure::UValidation_Project_LocalExposure()
 		EValidationWorkflow::ICVFX,
 		EValidationWorkflow::VAD
 	};
+	ValidationThreadSafety = EValidationThreadSafety::AnyThread;
 }
 
 FValidationResult UValidation_Project_LocalExposure::Validation_Implementation()
@@ -0,0 +1,102 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "Validation_Project_NDisplay_Mesh_2UVChannels.h"
+#include "Validation_Level_NDisplay_Mesh_2UVChannels.h"
+
+
+UValidation_Project_NDisplay_Mesh_2UVChannels::UValidation_Project_NDisplay_Mesh_2UVChannels()
+{
+	ValidationName = "NDisplay - Check 2 UV Channels For All Project Meshes";
+	ValidationDescription = "Any meshes which are being used by the nDisplay configs in the project need to have two UV "
+							"channels. Meshes are checked from the asset registry where possible and only loaded when "
+							"needed, See unreal docs for detailed info";
+	FixDescription = "No Fix available for this as will need to be fixed manually by the artists";
+	ValidationScope = EValidationScope::Project;
+	ValidationApplicableWorkflows = {
+		EValidationWorkflow::ICVFX
+	};
+}
+
+FValidationResult UValidation_Project_NDisplay_Mesh_2UVChannels::Validation_Implementation()
+{
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	FValidationResult Result = FValidationMeshAssetAudit::Validate(
+		&UValidation_Project_NDisplay_Mesh_2UVChannels::ValidateMeshTags,
+		&UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels);
+
+	if (Result.Result == EValidationStatus::Fail)
+	{
+		Result.Message += "Ensure LightMass UV Auto Generation Is Off & Meshes Have 2 UV Channels Only";
+	}
+	
+	return Result;
+#endif
+
+#if PLATFORM_MAC
+	FValidationResult ValidationResult = FValidationResult();
+	ValidationResult.Result = EValidationStatus::Warning;
+	ValidationResult.Message = "Ndisplay Validations Not Valid On OSX";
+	return ValidationResult;
+#endif
+}
+
+FValidationFixResult UValidation_Project_NDisplay_Mesh_2UVChannels::Fix_Implementation()
+{
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+	FValidationFixResult Result = FValidationFixResult(EValidationFixStatus::Fixed, "");
+	
+	FValidationResult VResult = FValidationMeshAssetAudit::Validate(
+		&UValidation_Project_NDisplay_Mesh_2UVChannels::ValidateMeshTags,
+		&UValidation_Level_NDisplay_Mesh_2UVChannels::ValidateMeshesWithout2UVChannels);
+
+	if (VResult.Result != EValidationStatus::Pass)
+	{
+		Result.Result = EValidationFixStatus::ManualFix;
+		Result.Message = VResult.Message;
+		Result.Message += "Ensure LightMass UV Auto Generation Is Off & Meshes Have 2 UV Channels Only";
+	}
+	return Result;
+#endif
+
+#if PLATFORM_MAC
+	FValidationFixResult ValidationFixResult = FValidationFixResult();
+	ValidationFixResult.Result = EValidationFixStatus::NotFixed;
+	ValidationFixResult.Message = "Ndisplay Validations Not Valid On OSX";
+	return ValidationFixResult;
+#endif
+}
+
+bool UValidation_Project_NDisplay_Mesh_2UVChannels::ValidateMeshTags(const FValidationMeshAssetTags& Tags, const FString& PathName,
+	EValidationStatus& OutStatus, FString& Message)
+{
+	// Any LOD failing fails the mesh, so LOD 0 alone can answer a failure
+	if (Tags.NumUVChannels != 2)
+	{
+		Message = PathName + " LOD 0 Has " + FString::FromInt(Tags.NumUVChannels) +" UV Channels Instead Of 2\n";
+		OutStatus = EValidationStatus::Fail;
+		return true;
+	}
+
+	// Otherwise the tags can only answer for meshes without further LODs
+	if (Tags.NumLODs == 1)
+	{
+		OutStatus = EValidationStatus::Pass;
+		return true;
+	}
+
+	return false;
+}
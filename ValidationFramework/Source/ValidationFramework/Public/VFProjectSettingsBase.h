@@ -55,4 +55,64 @@ public:
 	*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings")
 	FOpenColorIOColorConversionSettings ProjectOpenIOColorConfig;
+
+	/**
+	* When enabled, nDisplay meshes without full precision uvs are only failed when converting their uvs to half
+	* precision moves them by more than MaxUVHalfPrecisionErrorTexels at the LEDProcessorResolution. Measuring this
+	* requires reading the source uvs of those meshes, otherwise any mesh without full precision uvs is failed
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings")
+	bool bMeasureUVHalfPrecisionError;
+
+	/**
+	* The resolution the LED processors map the 0-1 uv space of the nDisplay meshes onto, used to measure uv errors in
+	* processor texels
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings", meta = (EditCondition = "bMeasureUVHalfPrecisionError"))
+	FIntPoint LEDProcessorResolution;
+
+	/**
+	* The largest error in processor texels which half precision uvs may introduce before full precision uvs are needed
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings", meta = (EditCondition = "bMeasureUVHalfPrecisionError", ClampMin = "0.0"))
+	float MaxUVHalfPrecisionErrorTexels;
+
+	/**
+	* The uv channel nDisplay projects content through on the led wall meshes, the only channel checked for overlapping
+	* and flipped uvs. Other channels, such as lightmap uvs, may legitimately overlap or mirror islands
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings", meta = (ClampMin = "0", ClampMax = "7"))
+	int32 NDisplayProjectionUVChannel;
+
+	/**
+	* The largest percentage of the 0-1 uv space which overlapping uvs in the projection channel may cover before a mesh
+	* fails. Overlaps are measured on a 1024x1024 grid, so this also tolerates cells shared along the seams of islands
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings", meta = (ClampMin = "0.0", ClampMax = "100.0"))
+	float MaxUVOverlapPercent;
+
+	/**
+	* When enabled, the OCIO configs used by the nDisplay setups are compared with ProjectOpenIOColorConfig by
+	* evaluating both transforms over a lattice of colors, rather than by their config asset and color space names.
+	* Configs which are named differently but produce the same colors then pass, and configs with matching names but
+	* different transforms fail
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings")
+	bool bCompareOCIOTransformsNumerically;
+
+	/**
+	* The largest delta E between the project OCIO transform and an nDisplay OCIO transform before they are considered
+	* different. The transformed values are usually display encoded but are measured as if they were linear Rec.709, so
+	* this is a numerical tolerance on the outputs rather than a perceptual threshold
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings", meta = (EditCondition = "bCompareOCIOTransformsNumerically", ClampMin = "0.0"))
+	float MaxOCIODeltaE;
+
+	/**
+	* The largest delta E the simulated output of an nDisplay viewport or inner frustum may stray from the level post
+	* processing followed by the project OCIO transform, once its own post processing, color grading and OCIO are applied.
+	* Measured in the same way as MaxOCIODeltaE, so is a numerical tolerance rather than a perceptual threshold
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Validation Framework Settings", meta = (ClampMin = "0.0"))
+	float MaxColorPipelineDeltaE;
 };
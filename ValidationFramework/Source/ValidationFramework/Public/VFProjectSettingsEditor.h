@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
 #include "VFProjectSettingsBase.h"
 #include "VFProjectSettingsEditor.generated.h"
 
@@ -30,9 +31,44 @@ class VALIDATIONFRAMEWORK_API UVFProjectSettingsEditor final: public UObject
 public:
 	UVFProjectSettingsEditor(const FObjectInitializer& obj);
 
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	/**
 	* Property to store a ValidationFrameworkProjectSettings asset within the UE Project settings
 	*/
 	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Validation Framework Settings")
 	TSubclassOf<UVFProjectSettingsBase> ValidationFrameworkSettings;
+
+	/**
+	* The content folders which are searched for blueprint validations, limiting these avoids waiting on the asset
+	* registry to discover the whole project. When left empty all mounted content is searched once the asset registry
+	* has finished loading. The validation framework plugin content is always searched
+	*/
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Validation Framework Settings", meta = (LongPackageName))
+	TArray<FDirectoryPath> ValidationContentPaths;
+
+	/**
+	* Meshes within the nDisplay setups whose package path starts with any of these are not led walls, so are skipped
+	* by the nDisplay mesh validations. Matched ignoring case, such as /Game/Stage/Helpers/
+	*/
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Validation Framework Settings")
+	TArray<FString> NDisplayMeshExclusionPathPrefixes;
+
+	/**
+	* Meshes within the nDisplay setups with any of these names are not led walls, so are skipped by the nDisplay mesh
+	* validations. Defaults to the camera and origin meshes nDisplay adds to every setup
+	*/
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Validation Framework Settings")
+	TArray<FName> NDisplayMeshExclusionNames;
+
+	/**
+	* Mesh components within the nDisplay setups with any of these tags are not led walls, so are skipped by the nDisplay
+	* mesh validations
+	*/
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Validation Framework Settings")
+	TArray<FName> NDisplayMeshExclusionComponentTags;
 };
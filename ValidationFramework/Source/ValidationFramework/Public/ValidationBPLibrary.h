@@ -17,11 +17,17 @@ limitations under the License.
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
 #include "ValidationBase.h"
 #include "ValidationCommon.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "ValidationBPLibrary.generated.h"
 
+class FValidationMeshAnalysis;
+class FValidationMeshExclusions;
+class FValidationOCIOResolver;
+struct FAssetData;
+
 /**
 * A Library of helper functions which are used in either c++ validations directly, or as blueprint nodes
 * within validation blueprints to simplify the logic & cleanliness of the node networks
@@ -33,12 +39,50 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 	GENERATED_UCLASS_BODY()
 
 	/**
-	* Gets all of the ValidationObjects which are defined in code or via blueprint
+	* Gets all of the ValidationObjects which are defined in code or via blueprint, these are served from the
+	* validation registry which is only rebuilt when validations are added, removed or recompiled
 	* @return An array of UObjects representing all of the validations in the project
 	*/
 	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
 	static TArray<UObject*> GetAllValidations();
 
+	/**
+	* Gets all of the ValidationObjects without blocking the game thread whilst the asset registry is still discovering
+	* blueprint validations. Blueprint callers should use the Get All Validations Async node instead
+	* @return A future which is fulfilled with all of the validations in the project once discovery has completed
+	*/
+	static TFuture<TArray<UObject*>> GetAllValidationsAsync();
+
+	/**
+	* Gets the ValidationObjects which apply to any of the given workflows and scopes, sorted by name. The filtering is
+	* precomputed by the validation registry so this is cheap to call repeatedly from UIs
+	* @param WorkflowMask - Bitmask of the workflows to include
+	* @param ScopeMask - Bitmask of the scopes to include
+	* @return An array of UObjects representing the matching validations
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
+	static TArray<UObject*> GetValidations(
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/ValidationFramework.EValidationWorkflow")) int32 WorkflowMask,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/ValidationFramework.EValidationScope")) int32 ScopeMask);
+
+	/**
+	* Runs all of the given validations as a single validation run, so validations shared through dependencies are
+	* only run once and thread safe validations are run concurrently
+	* @param Validations - The validations to run
+	* @return The result of each validation, in the same order as the validations given
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
+	static TArray<FValidationResult> RunValidations(const TArray<UObject*>& Validations);
+
+	/**
+	* Runs the fixes for all of the given validations as a single validation run, so fixes shared through
+	* dependencies are only applied once and fixes which re-run their validation reuse its result where possible
+	* @param Validations - The validations to fix
+	* @return The result of each fix, in the same order as the validations given
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
+	static TArray<FValidationFixResult> RunFixes(const TArray<UObject*>& Validations);
+
 	/**
 	* Gets all of the ValidationObjects which are defined via blueprints
 	* @return An array of UObjects representing all of the blueprint validations in the project
@@ -53,6 +97,13 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
 	static TArray<UObject*> GetAllValidationsFromCode();
 
+	/**
+	* Forces the validation registry to be rebuilt the next time validations are requested, the registry tracks
+	* changes itself so this is only needed if validations have been changed outside of the editor
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
+	static void RefreshValidationRegistry();
+
 	/**
 	* Get The ValidationFramework project settings for the UE Project
 	* @return The UObject set in the project settings derived from UVFProjectSettingsBase
@@ -310,11 +361,43 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 	static bool MarkCurrentLevelDirty();
 
 	/**
-	* Filters the meshes within the NDisplay setups for known meshes which are not actually led walls
+	* Gets all of the actors of the given class within the world, when a validation run is in progress these come from
+	* the run's world snapshot rather than walking every actor in the world again
+	* @param World - The UWorld we are operating within
+	* @param ActorClass - The class of actor to find
+	* @param OutActors - The actors of the given class or any of its subclasses
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary", meta = (DeterminesOutputType = "ActorClass", DynamicOutputParam = "OutActors"))
+	static void GetAllActorsOfClassForValidation(const UWorld* World, TSubclassOf<AActor> ActorClass, TArray<AActor*>& OutActors);
+
+	/**
+	* Filters the meshes within the NDisplay setups for known meshes which are not actually led walls, using the
+	* exclusion rules from GetNDisplayMeshExclusions
 	* @return whether the mesh should be validated or not
 	*/
 	static bool ExcludeMeshFromNDisplayValidation(const UStaticMesh* Mesh);
 
+	/**
+	* Filters the meshes within the NDisplay setups for known meshes which are not actually led walls, without needing
+	* the mesh to be loaded
+	* @return whether the mesh should be validated or not
+	*/
+	static bool ExcludeMeshAssetFromNDisplayValidation(const FAssetData& MeshAsset);
+
+	/**
+	* Gets the rules for which meshes within the NDisplay setups are not led walls, fixed for the active validation run,
+	* otherwise compiled from the project settings once and reused until the settings change
+	* @return The compiled exclusion rules
+	*/
+	static TSharedRef<const FValidationMeshExclusions> GetNDisplayMeshExclusions();
+
+	/**
+	* Gets the resolver which memoizes the OCIO color conversions resolved by the active validation run, otherwise a
+	* resolver just for this call
+	* @return The OCIO resolver
+	*/
+	static TSharedRef<FValidationOCIOResolver> GetOCIOResolver();
+
 	/**
 	* Helper function which handles the generic logic for the validation of a mesh associated to an NDisplay setup
 	* @param World - The UWorld we are operating within
@@ -326,6 +409,16 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 		const TFunction<EValidationStatus(UStaticMesh* StaticMesh, const int LodIndex, FString& Message)> InputValidationFunction
 		);
 
+	/**
+	* Gets the analysis of every mesh associated to the NDisplay setups in the world, shared with the rest of the
+	* validation run when one is active for the world, otherwise analyzed just for this call
+	* @param World - The UWorld we are operating within
+	* @param UVLayoutChannelMask - The uv channels to analyze the layouts of, one bit per channel, none by default
+	* @return The mesh analysis
+	*/
+	static TSharedRef<const FValidationMeshAnalysis> GetNDisplayMeshAnalysis(const UWorld* World,
+		const uint32 UVLayoutChannelMask = 0);
+
 	/**
 	* Exports The Validation Report To The Given Folder With A Given Suffix, This exports level and project validations
 	* in both csv * json format
@@ -337,6 +430,44 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
 	static bool ExportValidationReport(UValidationReportDataTable* ValidationReportDataTable, FString ReportPath="", const FString Suffix="");
 
+	/**
+	* Gets the name of the row a validation result is stored under, qualified by its level so that rows stay unique
+	* when a report covers several levels
+	* @param ValidationReportRow - The report row
+	* @return The row name
+	*/
+	static FString GetValidationReportRowName(const FValidationReportRow& ValidationReportRow);
+
+	/**
+	* Reads the rows of a validation report which was previously exported as json
+	* @param ReportPath - The path of the report without extension, as given when it was exported
+	* @param OutRows - The rows of the report in the order they were exported
+	* @return False if the report could not be read
+	*/
+	static bool ImportValidationReport(const FString& ReportPath, TArray<FValidationReportRow>& OutRows);
+
+	/**
+	* Merges several validation reports into a single report, rows which appear in more than one report such as project
+	* validations shared by several shards are only included once. Project rows come first followed by the rows for each
+	* level in the order given, so the merged report does not depend on how the levels were split between the reports
+	* @param ReportPaths - The paths of the reports to merge without extension
+	* @param LevelPaths - The levels in the order their rows should appear
+	* @param OutWorstStatus - The most severe status of any row in the merged report
+	* @return The merged ValidationReport DataTable, or nullptr if any of the reports could not be read
+	*/
+	static UValidationReportDataTable* MergeValidationReports(
+		const TArray<FString>& ReportPaths, const TArray<FString>& LevelPaths, EValidationStatus& OutWorstStatus);
+
+	/**
+	* Builds a single report from rows gathered from several reports or runs, see MergeValidationReports
+	* @param ReportRows - The rows to merge, where rows share a name the first is kept
+	* @param LevelPaths - The levels in the order their rows should appear
+	* @param OutWorstStatus - The most severe status of any row in the merged report
+	* @return The merged ValidationReport DataTable
+	*/
+	static UValidationReportDataTable* MergeValidationReportRows(
+		TArray<FValidationReportRow> ReportRows, const TArray<FString>& LevelPaths, EValidationStatus& OutWorstStatus);
+
 	/**
 	* Creates a new ValidationReport DataTable
 	* @return An empty ValidationReport DataTable UObject ready to be populated
@@ -349,11 +480,12 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 	* @param ValidationReportDataTable - The data table we want to add the result too
 	* @param Validation - The validation object the results relate too
 	* @param ValidationResult - The results of the actual validation
+	* @param Level - The level the validation was run against, used to tell rows apart in reports covering several levels
 	*/
 	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
 	static void AddValidationResultToReport(
 		UValidationReportDataTable* ValidationReportDataTable,
-		UValidationBase* Validation, FValidationResult ValidationResult);
+		UValidationBase* Validation, FValidationResult ValidationResult, const FString Level="");
 
 	/**
 	* For a given level and workflow we generate a validation report in the given report path.
@@ -365,6 +497,41 @@ class VALIDATIONFRAMEWORK_API UValidationBPLibrary final : public UBlueprintFunc
 	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
 	static bool GenerateValidationReport(const FString LevelPath, const EValidationWorkflow Workflow, const FString ReportPath="");
 
+	/**
+	* For a given level we generate a validation report covering all of the given workflows in the given report path,
+	* each validation is only run once even if it belongs to several of the workflows
+	* @param LevelPath - The path to the level we want to validate
+	* @param WorkflowMask - Mask of the workflows we want to validate for, see ValidationWorkflowToMask
+	* @param ReportPath - The path of the report without extension, empty uses the default report location
+	* @param OutWorstStatus - The most severe status returned by any of the validations which were run
+	* @return Whether the level could be loaded and the report written
+	*/
+	static bool GenerateValidationReportForWorkflows(
+		const FString& LevelPath, uint32 WorkflowMask, const FString& ReportPath, EValidationStatus& OutWorstStatus);
+
+	/**
+	* For a set of levels and a workflow we generate a single combined validation report in the given report path.
+	* Project validations are only run once for the whole batch, the levels are then loaded and validated one after
+	* another with each row of the report recording the level it belongs to
+	* @param LevelPaths - The paths to the levels we want to validate
+	* @param Workflow - The workflow we want to validate for
+	* @param ReportPath - The path of the report without extension, empty writes to ValidationReports/Batch in the project
+	* @return Whether all of the levels could be loaded and the report written
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary")
+	static bool GenerateBatchValidationReport(const TArray<FString>& LevelPaths, const EValidationWorkflow Workflow, const FString ReportPath="");
+
+	/**
+	* For a set of levels we generate a single combined validation report covering all of the given workflows
+	* @param LevelPaths - The paths to the levels we want to validate
+	* @param WorkflowMask - Mask of the workflows we want to validate for, see ValidationWorkflowToMask
+	* @param ReportPath - The path of the report without extension, empty writes to ValidationReports/Batch in the project
+	* @param OutWorstStatus - The most severe status returned by any of the validations which were run
+	* @return Whether all of the levels could be loaded and the report written, levels which fail to load are skipped
+	*/
+	static bool GenerateBatchValidationReportForWorkflows(
+		const TArray<FString>& LevelPaths, uint32 WorkflowMask, const FString& ReportPath, EValidationStatus& OutWorstStatus);
+
 	/**
 	* Checks that any Sequences found in the world, have frame rates which match the given frame rate, or are valid
 	* multiples
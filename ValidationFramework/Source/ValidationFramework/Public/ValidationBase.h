@@ -65,6 +65,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite,  Category="ValidationBPLibrary")
 	EValidationScope ValidationScope;
 
+	/**
+	* Which threads the validation can be run on, only c++ validations can run away from the game thread as blueprint
+	* implementations always go through the script VM
+	*/
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly,  Category="ValidationBPLibrary")
+	EValidationThreadSafety ValidationThreadSafety = EValidationThreadSafety::GameThread;
+
+	/**
+	* The validations whose results this validation relies on, these are run through RunDependency so that within a
+	* validation run each dependency is only ever checked once, and so fixing a dependency re-runs this validation
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite,  Category="ValidationBPLibrary")
+	TArray<TSubclassOf<UValidationBase>> ValidationDependencies;
+
 	/**
 	* The blueprint event which should be implemented by the artist/td within blueprints, that deals with the checks
 	* to define whether something is valid or not for the defined scope and workflow
@@ -82,7 +96,7 @@ public:
 
 	/**
 	* Function which runs the validation regardless of whether the validation is implemented in code or
-	* blueprints
+	* blueprints, within a validation run the result is memoized so the validation is only run once
 	* @return A validation result containing the result status and any info messages from the validation
 	*/
 	UFUNCTION(BlueprintCallable,  Category="ValidationBPLibrary")
@@ -105,12 +119,44 @@ public:
 
 	/**
 	* Function which runs the fix regardless of whether the validation is implemented in code or
-	* blueprints
+	* blueprints, within a validation run the fix is only applied once
 	* @return A validation fix result containing the fix status and any info messages from the validation fix
 	*/
 	UFUNCTION(BlueprintCallable,  Category="ValidationBPLibrary")
 	FValidationFixResult RunFix();
 
+	/**
+	* Runs one of the validations this validation depends on, within a validation run the dependency is only run once
+	* and its result shared between all of the validations which depend on it
+	* @param Dependency - The class of the validation to run, this should be listed in ValidationDependencies
+	* @return A validation result containing the result status and any info messages from the dependency
+	*/
+	UFUNCTION(BlueprintCallable,  Category="ValidationBPLibrary")
+	FValidationResult RunDependency(TSubclassOf<UValidationBase> Dependency);
+
+	/**
+	* Runs the fix of one of the validations this validation depends on, within a validation run the fix is only
+	* applied once regardless of how many validations depend on it
+	* @param Dependency - The class of the validation to fix, this should be listed in ValidationDependencies
+	* @return A validation fix result containing the fix status and any info messages from the dependency fix
+	*/
+	UFUNCTION(BlueprintCallable,  Category="ValidationBPLibrary")
+	FValidationFixResult RunDependencyFix(TSubclassOf<UValidationBase> Dependency);
+
+	/**
+	* Whether the given validation is one of this validation's declared dependencies
+	* @param ValidationClass - The class of the validation to check
+	* @return True if the validation is listed in ValidationDependencies
+	*/
+	bool DependsOn(const UClass* ValidationClass) const;
+
+	/**
+	* Whether the validation can be run on a worker thread, this requires the validation to declare itself thread safe
+	* and to be implemented in c++
+	* @return True if the scheduler can run the validation away from the game thread
+	*/
+	bool CanRunValidationOffGameThread() const;
+
 	/**
 	* Ensures that we always get the correct world as often we are running within UI widgets and this is not easily
 	* accessible
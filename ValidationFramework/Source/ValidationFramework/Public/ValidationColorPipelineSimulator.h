@@ -0,0 +1,98 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OpenColorIOColorSpace.h"
+
+struct FPostProcessSettings;
+
+/**
+* The grading settings which the post processing validations flag, resolved for one viewport or inner frustum of a
+* stage. Defaults to a neutral grade which leaves colors unchanged
+*/
+struct VALIDATIONFRAMEWORK_API FValidationColorGrade
+{
+	/** Exposure compensation in stops */
+	float ExposureBias = 0.f;
+
+	/** Local exposure contrast scales and middle grey bias, applied to flat test patches */
+	float LocalExposureHighlightContrastScale = 1.f;
+	float LocalExposureShadowContrastScale = 1.f;
+	float LocalExposureMiddleGreyBias = 0.f;
+
+	float BlueCorrection = 0.f;
+	float ExpandGamut = 0.f;
+
+	/** How much of the filmic tone curve is applied, along with the shape of the curve */
+	float ToneCurveAmount = 0.f;
+	float FilmSlope = 0.88f;
+	float FilmToe = 0.55f;
+	float FilmShoulder = 0.26f;
+	float FilmBlackClip = 0.f;
+	float FilmWhiteClip = 0.04f;
+
+	/**
+	* Applies the members of the post process settings which are overridden
+	* @param Settings - The post process settings, for example from an unbound post process volume
+	*/
+	void ApplyOverrides(const FPostProcessSettings& Settings);
+
+	/**
+	* Gets the grade the engine uses when nothing is overridden, which is not neutral as the tone curve, blue
+	* correction and expand gamut are all enabled by default
+	* @return The default grade
+	*/
+	static FValidationColorGrade EngineDefault();
+
+	bool operator==(const FValidationColorGrade& Other) const;
+	friend uint32 GetTypeHash(const FValidationColorGrade& Grade);
+};
+
+/**
+* Simulates the color pipeline of a stage on the CPU, so the output of an ICVFX setup can be predicted on a build agent
+* without a GPU. Test patches are pushed through the exposure, local exposure, blue correction, expand gamut and tone
+* curve of a grade in the ACEScg working space the tonemapper grades in, then through the OCIO transform of the
+* viewport. This is a model of the settings the validations flag rather than a reimplementation of the tonemapper,
+* the ACES glow and red modifier of the filmic curve and any spatial effects are left out
+*/
+class VALIDATIONFRAMEWORK_API FValidationColorPipelineSimulator
+{
+public:
+	/**
+	* Gets the test patches pushed through the pipeline, the same lattice and HDR ramps used to compare OCIO transforms
+	* @return The test patches in the working color space
+	*/
+	static TConstArrayView<FLinearColor> GetTestPatches();
+
+	/**
+	* Applies a grade to a batch of colors, evaluated with SIMD across the channels of each color and in parallel
+	* across batches of colors
+	* @param Grade - The grade to apply
+	* @param InOutColors - The packed linear colors in the working color space to grade
+	*/
+	static void EvaluateGrade(const FValidationColorGrade& Grade, TArrayView<FLinearColor> InOutColors);
+
+	/**
+	* Pushes the test patches through a grade and then an optional OCIO transform
+	* @param Grade - The grade of the viewport
+	* @param OCIOSettings - The OCIO transform of the viewport, or nullptr if it has none
+	* @param OutColors - The simulated output of each test patch
+	* @return Whether the OCIO transform could be evaluated
+	*/
+	static bool Simulate(const FValidationColorGrade& Grade, const FOpenColorIOColorConversionSettings* OCIOSettings, TArray<FLinearColor>& OutColors);
+};
@@ -0,0 +1,115 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ValidationCommon.h"
+#include "ValidationManifest.h"
+#include "ValidationCommandlet.generated.h"
+
+/**
+* Commandlet which generates validation reports for a set of levels without starting the editor UI, so validations can
+* be run on CI build agents. Intended to be run with -nullrhi -unattended, for example
+*
+* UnrealEditor-Cmd Project.uproject -run=Validation -Levels=/Game/Maps/StageA+/Game/Maps/StageB -Workflows=ICVFX+VAD
+*	-ReportDir=/path/to/reports -FailOn=Warning -nullrhi -unattended
+*
+* -Levels		The long package names of the levels to validate, separated by + or ,
+* -LevelList	A text file containing one level per line, combined with any given by -Levels
+* -Workflows	The workflows to validate for, separated by + or , defaults to all workflows
+* -ReportDir	The folder reports are written to as ReportDir/LevelName/LevelName, defaults to Project/ValidationReports
+* -FailOn		Fail, Warning or Never, the validation status which causes a non zero exit code, defaults to Fail
+* -Combined	Writes a single report for all of the levels to ReportDir/Batch, running project validations only once
+* -Shards		Splits the levels between this many worker processes which each write a combined report to
+*				ReportDir/Shards, these are merged into a single report at ReportDir/Batch once all of the workers finish
+* -ShardRetries	How many times a worker which crashes or times out is relaunched, defaults to 1
+* -ShardTimeout	How many seconds a worker may run before it is killed and relaunched, defaults to no limit
+* -Incremental	Only validates levels whose package dependencies, or the validation settings, changed since the last run,
+*				reusing the previous report rows for the rest. Project validations are always rerun. Implies -Combined
+* -Manifest		The file incremental runs record what was validated in, defaults to ReportDir/Manifest.json
+*
+* Returns 0 when all levels are valid, 1 when a validation met the -FailOn status and 2 when the arguments were invalid
+* or a level could not be loaded or reported
+*/
+UCLASS()
+class VALIDATIONFRAMEWORK_API UValidationCommandlet final : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UValidationCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/**
+	* Validates the levels by splitting them between several local worker processes running this commandlet, waiting
+	* for all of them and merging their reports. Workers which crash or run past the timeout are relaunched up to the
+	* retry limit
+	* @param Levels - The long package names of the levels to validate
+	* @param NumShards - The number of worker processes to split the levels between
+	* @param MaxRetries - How many times a crashed worker is relaunched
+	* @param Timeout - How many seconds a worker may run before it is killed and relaunched, no limit when zero
+	* @param Workflows - The -Workflows argument passed on to each worker
+	* @param ReportPath - The path the merged report is written to, shard reports are written beside it
+	* @param OutWorstStatus - The most severe status in the merged report
+	* @return False if any shard could not be validated or the reports could not be merged
+	*/
+	static bool RunShards(const TArray<FString>& Levels, int32 NumShards, int32 MaxRetries, double Timeout,
+		const FString& Workflows, const FString& ReportPath, EValidationStatus& OutWorstStatus);
+
+	/**
+	* Combines the rows reused from the manifest with those of the project validations and levels validated in this run
+	* into the final report, and records the changed levels in the manifest for the next run
+	* @param Manifest - The manifest loaded at the start of the run
+	* @param ManifestPath - Where the manifest is saved
+	* @param ChangedLevels - The closures of the levels which were validated in this run
+	* @param ReusedRows - The rows of the unchanged levels
+	* @param Levels - All of the levels in the order their rows should appear
+	* @param BatchReportPath - The combined report written by this run, which is replaced by the final report
+	* @param OutWorstStatus - The most severe status in the final report
+	* @return False if the report or manifest could not be read or written
+	*/
+	static bool UpdateIncrementalReport(FValidationManifest& Manifest, const FString& ManifestPath,
+		TMap<FString, FValidationManifestLevel> ChangedLevels, TArray<FValidationReportRow> ReusedRows,
+		const TArray<FString>& Levels, const FString& BatchReportPath, EValidationStatus& OutWorstStatus);
+
+	/**
+	* Gathers the levels to validate from the -Levels and -LevelList arguments
+	* @param ParamVals - The parsed commandlet arguments
+	* @param OutLevels - The long package names of the levels to validate
+	* @return False if a level list was given but could not be read
+	*/
+	static bool ParseLevels(const TMap<FString, FString>& ParamVals, TArray<FString>& OutLevels);
+
+	/**
+	* Parses the -Workflows argument into a workflow mask
+	* @param ParamVals - The parsed commandlet arguments
+	* @param OutWorkflowMask - The mask of the workflows to validate for
+	* @return False if any of the workflows are not recognised
+	*/
+	static bool ParseWorkflows(const TMap<FString, FString>& ParamVals, uint32& OutWorkflowMask);
+
+	/**
+	* Parses the -FailOn argument into the validation status which causes the commandlet to fail
+	* @param ParamVals - The parsed commandlet arguments
+	* @param OutFailStatus - The least severe status which fails the commandlet, unset if it should never fail
+	* @return False if the policy is not recognised
+	*/
+	static bool ParseFailOn(const TMap<FString, FString>& ParamVals, TOptional<EValidationStatus>& OutFailStatus);
+};
@@ -129,7 +129,7 @@ struct FValidationFixResult
 * Simply extending this enum exposes new options in the workflow selection from the UI, as well as
 * allowing validations to register to this new workflow option
 */
-UENUM(BlueprintType)
+UENUM(BlueprintType, meta = (Bitflags))
 enum class EValidationWorkflow : uint8
 {
 	ICVFX			UMETA(DisplayName = "ICVFX"),
@@ -142,13 +142,64 @@ enum class EValidationWorkflow : uint8
 * An enum representing whether the validations are related to the Project or to a Level, this provides better granularity
 * when filtering all of the validations in UIs or via code
 */
-UENUM(BlueprintType)
+UENUM(BlueprintType, meta = (Bitflags))
 enum class EValidationScope : uint8
 {
 	Project		UMETA(DisplayName = "ProjectValidation"),
 	Level		UMETA(DisplayName = "LevelValidation")
 };
 
+/**
+* An enum representing which threads a validation can safely be run on. Validations which only read immutable data,
+* such as project settings, can declare themselves safe to run on any thread so they are scheduled concurrently
+*/
+UENUM(BlueprintType)
+enum class EValidationThreadSafety : uint8
+{
+	GameThread		UMETA(DisplayName = "GameThread"),
+	AnyThread		UMETA(DisplayName = "AnyThread")
+};
+
+/**
+* Converts a workflow into its bit within a workflow mask, as used when querying the validation registry
+* @param Workflow - The workflow to convert
+* @return The mask with only the bit for the given workflow set
+*/
+FORCEINLINE uint32 ValidationWorkflowToMask(const EValidationWorkflow Workflow)
+{
+	return 1u << static_cast<uint32>(Workflow);
+}
+
+/**
+* Converts an array of workflows into a workflow mask with a bit set for each of them
+* @param Workflows - The workflows to convert
+* @return The combined mask of all of the given workflows
+*/
+FORCEINLINE uint32 ValidationWorkflowsToMask(const TArray<EValidationWorkflow>& Workflows)
+{
+	uint32 Mask = 0;
+	for (const EValidationWorkflow Workflow : Workflows)
+	{
+		Mask |= ValidationWorkflowToMask(Workflow);
+	}
+	return Mask;
+}
+
+/**
+* Converts a scope into its bit within a scope mask, as used when querying the validation registry
+* @param Scope - The scope to convert
+* @return The mask with only the bit for the given scope set
+*/
+FORCEINLINE uint32 ValidationScopeToMask(const EValidationScope Scope)
+{
+	return 1u << static_cast<uint32>(Scope);
+}
+
+/**
+* Mask which matches every workflow or scope when querying the validation registry
+*/
+constexpr uint32 ValidationMaskAll = MAX_uint32;
+
 /**
 * A struct to represent the rows within a data table, used to generate a validation report
 */
@@ -187,6 +238,13 @@ public:
 	*/
 	UPROPERTY()
 	FString Fix;
+
+	/**
+	* The level the validation was run against, empty for project validations and reports generated from the UI. Kept
+	* as the last column so existing consumers of the report columns are unaffected
+	*/
+	UPROPERTY()
+	FString Level;
 };
 
 /**
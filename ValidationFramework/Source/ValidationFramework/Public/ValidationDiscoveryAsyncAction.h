@@ -0,0 +1,62 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "ValidationDiscoveryAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FValidationDiscoveryDelegate, const TArray<UObject*>&, Validations);
+
+/**
+* Blueprint async node which gathers all of the validations without blocking the editor whilst the asset registry is
+* still discovering the project. Validations are reported as they are found so UIs can populate incrementally, followed
+* by the complete list once discovery has finished
+*/
+UCLASS()
+class VALIDATIONFRAMEWORK_API UValidationDiscoveryAsyncAction final : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	* Fired with any newly discovered blueprint validations whilst the asset registry is still loading
+	*/
+	UPROPERTY(BlueprintAssignable)
+	FValidationDiscoveryDelegate OnValidationsDiscovered;
+
+	/**
+	* Fired once with all of the validations in the project when discovery has completed
+	*/
+	UPROPERTY(BlueprintAssignable)
+	FValidationDiscoveryDelegate OnCompleted;
+
+	/**
+	* Gets all of the ValidationObjects which are defined in code or via blueprint without blocking the editor
+	* @return The async action which reports the discovered validations
+	*/
+	UFUNCTION(BlueprintCallable, Category="ValidationBPLibrary", meta=(BlueprintInternalUseOnly="true"))
+	static UValidationDiscoveryAsyncAction* GetAllValidationsAsync();
+
+	virtual void Activate() override;
+
+private:
+	void HandleValidationsDiscovered(const TArray<UObject*>& NewValidations);
+	void HandleCompleted(const TArray<UObject*>& Validations);
+
+	FDelegateHandle DiscoveredHandle;
+};
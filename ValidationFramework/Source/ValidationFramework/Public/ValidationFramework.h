@@ -28,7 +28,7 @@ public:
 
 	/**
 	* Startup Module handles the initializing of the Netflix Style Sheet, adds and registers the validation framework
-	* project settings, adds and registers the menu
+	* project settings, adds and registers the menu. When running as a commandlet only the project settings are registered
 	*/
 	virtual void StartupModule() override;
 
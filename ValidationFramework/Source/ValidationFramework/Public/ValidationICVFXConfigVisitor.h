@@ -0,0 +1,107 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "DisplayClusterConfigurationTypes_ICVFX.h"
+
+class ADisplayClusterRootActor;
+class UDisplayClusterConfigurationClusterNode;
+class UDisplayClusterConfigurationViewport;
+class UDisplayClusterICVFXCameraComponent;
+
+/**
+* Walks the ICVFX configuration of the nDisplay setups in a world, from each root actor to its stage settings, the per
+* viewport profiles of the stage, the cluster nodes and their viewports, each ICVFX camera and the per node profiles of
+* the camera. Validations override only the callbacks they need, every callback is handed a const reference into the
+* configuration itself so nothing is copied however many viewports, cameras and nodes a stage has
+*/
+class VALIDATIONFRAMEWORK_API FValidationICVFXConfigVisitor
+{
+public:
+	virtual ~FValidationICVFXConfigVisitor() = default;
+
+	/**
+	* Walks every nDisplay root actor in the world, found through UValidationBPLibrary::GetAllActorsOfClassForValidation
+	* @param World - The world containing the nDisplay setups
+	*/
+	void Visit(const UWorld* World);
+
+	/**
+	* Walks the configuration of a single nDisplay root actor
+	* @param RootActor - The root actor to walk
+	*/
+	void VisitRootActor(const ADisplayClusterRootActor& RootActor);
+
+protected:
+	/**
+	* Called before anything else is visited for a root actor
+	*/
+	virtual void OnRootActorBegin(const ADisplayClusterRootActor& RootActor) {}
+
+	/**
+	* Called once everything has been visited for a root actor
+	*/
+	virtual void OnRootActorEnd(const ADisplayClusterRootActor& RootActor) {}
+
+	/**
+	* Called with the stage settings of a root actor, before any of its per viewport profiles
+	*/
+	virtual void OnStageSettings(const ADisplayClusterRootActor& RootActor, const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings) {}
+
+	/**
+	* Called for each per viewport OCIO profile of the stage settings
+	* @param ProfileIndex - The index of the profile within the stage settings
+	*/
+	virtual void OnPerViewportOCIOProfile(const ADisplayClusterRootActor& RootActor, int32 ProfileIndex, const FDisplayClusterConfigurationOCIOProfile& Profile) {}
+
+	/**
+	* Called for each per viewport color grading profile of the stage settings
+	* @param ProfileIndex - The index of the profile within the stage settings
+	*/
+	virtual void OnPerViewportColorGrading(const ADisplayClusterRootActor& RootActor, int32 ProfileIndex, const FDisplayClusterConfigurationViewport_PerViewportColorGrading& ColorGrading) {}
+
+	/**
+	* Called for each cluster node of a root actor, after the stage settings and before any of the node's viewports
+	* @param NodeId - The name of the node within the cluster
+	*/
+	virtual void OnClusterNode(const ADisplayClusterRootActor& RootActor, const FString& NodeId, const UDisplayClusterConfigurationClusterNode& ClusterNode) {}
+
+	/**
+	* Called for each viewport of a cluster node
+	* @param NodeId - The name of the node owning the viewport
+	* @param ViewportId - The name of the viewport within the node
+	*/
+	virtual void OnViewport(const ADisplayClusterRootActor& RootActor, const FString& NodeId, const FString& ViewportId,
+		const UDisplayClusterConfigurationViewport& Viewport) {}
+
+	/**
+	* Called for each ICVFX camera of a root actor whether or not it is enabled, before any of its per node profiles
+	*/
+	virtual void OnICVFXCamera(const ADisplayClusterRootActor& RootActor, const UDisplayClusterICVFXCameraComponent& CameraComponent,
+		const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings) {}
+
+	/**
+	* Called for each per node OCIO profile of an ICVFX camera
+	* @param ProfileIndex - The index of the profile within the camera settings
+	*/
+	virtual void OnPerNodeOCIOProfile(const ADisplayClusterRootActor& RootActor, const UDisplayClusterICVFXCameraComponent& CameraComponent,
+		int32 ProfileIndex, const FDisplayClusterConfigurationOCIOProfile& Profile) {}
+};
+#endif
@@ -0,0 +1,113 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationCommon.h"
+
+/**
+* What was validated for a single level in a previous run, and the report rows it produced
+*/
+struct FValidationManifestLevel
+{
+	/**
+	* Hash of every package the level depends upon, combined in package name order
+	*/
+	FString ClosureHash;
+
+	/**
+	* The content hash of each package in the level's dependency closure, kept so changes can be traced to a package
+	*/
+	TMap<FString, FString> PackageHashes;
+
+	/**
+	* The report rows produced for the level
+	*/
+	TArray<FValidationReportRow> Rows;
+};
+
+/**
+* Persistent record of a previous validation run used to only revalidate levels which could have changed. Each level
+* stores the content hashes of its package dependency closure, and the manifest as a whole stores a hash of everything
+* else which can change the results, the engine, plugin and validation versions, the project config and the workflows.
+* When the settings hash matches, levels whose closure hash also matches reuse their previous report rows
+*/
+class VALIDATIONFRAMEWORK_API FValidationManifest
+{
+public:
+	/**
+	* Reads a manifest written by a previous run, an unreadable or out of date manifest leaves this one empty
+	* @param ManifestPath - The manifest file
+	* @return False if the manifest could not be read
+	*/
+	bool Load(const FString& ManifestPath);
+
+	/**
+	* Writes the manifest so that the next run can reuse it
+	* @param ManifestPath - The manifest file
+	* @return False if the manifest could not be written
+	*/
+	bool Save(const FString& ManifestPath) const;
+
+	/**
+	* Hashes everything other than level content which affects validation results, the engine version, the plugin
+	* version, the binaries of every module which implements validations, the blueprint validation packages, the
+	* project config and the workflows being validated
+	* @param WorkflowMask - Mask of the workflows being validated
+	* @return The settings hash
+	*/
+	static FString ComputeSettingsHash(uint32 WorkflowMask);
+
+	/**
+	* Walks the asset registry for every package the level depends upon, including world partition external actors and
+	* objects, and hashes their content. Packages shared between levels are only hashed once per manifest, packages
+	* outside of the project are covered by the engine version in the settings hash so are not read
+	* @param LevelPath - The long package name of the level
+	* @param OutPackageHashes - The hash of each package in the closure
+	* @return The hash of the whole closure
+	*/
+	FString ComputeLevelClosureHash(const FString& LevelPath, TMap<FString, FString>& OutPackageHashes);
+
+	/**
+	* Clears every level, used when the settings hash no longer matches
+	* @param NewSettingsHash - The settings hash of the current run
+	*/
+	void Reset(const FString& NewSettingsHash);
+
+	const FString& GetSettingsHash() const { return SettingsHash; }
+
+	const FValidationManifestLevel* FindLevel(const FString& LevelPath) const { return Levels.Find(LevelPath); }
+	void SetLevel(const FString& LevelPath, FValidationManifestLevel Level) { Levels.Add(LevelPath, MoveTemp(Level)); }
+	void RemoveLevel(const FString& LevelPath) { Levels.Remove(LevelPath); }
+
+private:
+	/**
+	* Hashes the files of a package, the package file itself along with any export and bulk data stored beside it
+	* @param PackageName - The long package name
+	* @return The content hash of the package
+	*/
+	FString HashPackage(FName PackageName);
+
+	FString SettingsHash;
+
+	TMap<FString, FValidationManifestLevel> Levels;
+
+	/**
+	* Package hashes computed during this run, levels commonly share most of their dependencies
+	*/
+	TMap<FName, FString> PackageHashCache;
+};
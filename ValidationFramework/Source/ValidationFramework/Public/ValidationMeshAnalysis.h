@@ -0,0 +1,170 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationCommon.h"
+#include "ValidationUVBounds.h"
+#include "ValidationUVLayout.h"
+
+class UStaticMesh;
+struct FStaticMeshRenderData;
+struct FStaticMeshSourceModel;
+
+/**
+* Everything the nDisplay mesh validations need to know about a single LOD of a mesh
+*/
+struct FValidationMeshLODFacts
+{
+	int32 NumUVChannels = 0;
+	uint32 NumVertices = 0;
+	uint32 NumTriangles = 0;
+
+	/**
+	* Whether the uvs could be read on the CPU, UVBounds and UVLayouts are empty when they could not
+	*/
+	bool bHasCPUUVs = false;
+
+	/**
+	* Whether the render data holds no CPU copy of the uvs, so they were read from the source mesh description instead.
+	* The vertex and triangle counts, and the number of channels with bounds, are then those of the source
+	*/
+	bool bUVsFromMeshDescription = false;
+	TArray<FValidationUVChannelBounds> UVBounds;
+
+	/**
+	* The layout of each uv channel, only analyzed for the channels in the UVLayoutChannelMask the analysis was built
+	* with, the other channels are left default
+	*/
+	TArray<FValidationUVLayoutFacts> UVLayouts;
+
+	/**
+	* The largest change in u and v of each channel from converting the full precision uvs to half precision, only
+	* measured when FValidationMeshAnalysis::ShouldMeasureHalfPrecisionError, and empty when no full precision uvs were
+	* available to measure against
+	*/
+	TArray<FVector2f> UVHalfPrecisionErrors;
+
+	bool bGenerateLightmapUVs = false;
+	bool bUseFullPrecisionUVs = false;
+};
+
+/**
+* Everything the nDisplay mesh validations need to know about a mesh, gathered for every LOD in one pass
+*/
+struct FValidationMeshFacts
+{
+	FString PathName;
+	TArray<FValidationMeshLODFacts> LODs;
+
+	/**
+	* The readable names of every nDisplay component which uses the mesh, across all of the root actors
+	*/
+	TArray<FString> ReferencingComponents;
+};
+
+/**
+* Everything the analysis reads from a mesh itself, gathered on the game thread so the analysis workers never call into
+* the UStaticMesh. The render data and source models are owned by the mesh, so the mesh has to stay loaded and unchanged
+* until the analysis is done, which holds whilst the game thread waits on it
+*/
+struct FValidationMeshAnalysisInput
+{
+	struct FLOD
+	{
+		int32 NumUVChannels = 0;
+		bool bGenerateLightmapUVs = false;
+		bool bUseFullPrecisionUVs = false;
+
+#if WITH_EDITORONLY_DATA
+		/**
+		* The source model of the LOD, read when the render data holds no CPU copy of the uvs, null if there is none
+		*/
+		const FStaticMeshSourceModel* SourceModel = nullptr;
+#endif
+	};
+
+	FString PathName;
+	FString CacheKey;
+	const FStaticMeshRenderData* RenderData = nullptr;
+	TArray<FLOD> LODs;
+	bool bMeasureHalfPrecisionError = false;
+	uint32 UVLayoutChannelMask = 0;
+};
+
+/**
+* Analysis of every unique mesh used by the nDisplay setups in a world. Stages commonly instance the same mesh on many
+* components across several root actors, so meshes are deduplicated and every component using a mesh is recorded
+* against it instead. Each unique mesh is then analyzed in parallel, with all of the facts the mesh validations check
+* computed together in one visit per LOD, so the validations themselves are cheap lookups. Within a validation run the
+* analysis is built once and shared, see FValidationRunContext::GetMeshAnalysis. The analysis is built on the game
+* thread, only the reading of the gathered mesh buffers is spread across workers
+*/
+class VALIDATIONFRAMEWORK_API FValidationMeshAnalysis : public FNoncopyable
+{
+public:
+	/**
+	* Analyzes the meshes of every nDisplay root actor in the world, skipping the meshes and components excluded by
+	* UValidationBPLibrary::GetNDisplayMeshExclusions. Must be called on the game thread
+	* @param World - The world containing the nDisplay setups
+	* @param UVLayoutChannelMask - The uv channels to analyze the layouts of, one bit per channel. Layout analysis is by
+	* far the most expensive part, so it is only done for the validations which ask for it
+	*/
+	explicit FValidationMeshAnalysis(const UWorld* World, const uint32 UVLayoutChannelMask = 0);
+
+	/**
+	* Gathers what the analysis needs from a mesh, which must have finished compiling. Must be called on the game thread
+	* @param StaticMesh - The mesh to analyze
+	* @param bMeasureHalfPrecisionError - Whether to measure the error of converting the uvs to half precision, from
+	* ShouldMeasureHalfPrecisionError
+	* @param UVLayoutChannelMask - The uv channels to analyze the layouts of, one bit per channel
+	* @return The input for AnalyzeMesh
+	*/
+	static FValidationMeshAnalysisInput GatherMesh(const UStaticMesh* StaticMesh, const bool bMeasureHalfPrecisionError,
+		const uint32 UVLayoutChannelMask = 0);
+
+	/**
+	* Computes the facts for every LOD of a single mesh, or reads them from FValidationMeshAnalysisCache when the mesh
+	* has been analyzed before. Safe to call from any thread
+	* @param Input - The input gathered from the mesh by GatherMesh
+	* @return The facts of the mesh
+	*/
+	static FValidationMeshFacts AnalyzeMesh(const FValidationMeshAnalysisInput& Input);
+
+	/**
+	* Whether the analysis measures the error of converting uvs to half precision, as enabled in the project settings.
+	* Must be called on the game thread
+	* @return Whether UVHalfPrecisionErrors are measured
+	*/
+	static bool ShouldMeasureHalfPrecisionError();
+
+	/**
+	* Runs a check against every LOD of every analyzed mesh, combining the results in the same way as
+	* UValidationBPLibrary::NDisplayMeshSettingsValidation. Any messages for a mesh are followed by the components using it
+	* @param Check - Checks the facts of a single LOD, adding to the message for any issues found
+	* @return The combined ValidationResult
+	*/
+	FValidationResult Validate(TFunctionRef<EValidationStatus(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)> Check) const;
+
+	const TArray<FValidationMeshFacts>& GetMeshes() const { return Meshes; }
+
+	uint32 GetUVLayoutChannelMask() const { return UVLayoutChannelMask; }
+
+private:
+	TArray<FValidationMeshFacts> Meshes;
+	uint32 UVLayoutChannelMask = 0;
+};
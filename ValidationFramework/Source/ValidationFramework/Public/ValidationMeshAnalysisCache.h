@@ -0,0 +1,109 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationMeshAnalysis.h"
+
+class UStaticMesh;
+
+/**
+* Persistent cache of mesh analysis results, so repeat runs against unchanged meshes never read their vertex data.
+* Entries are keyed by the derived data key of the mesh render data, which changes whenever the mesh is reimported or
+* its build settings change, combined with a version which is bumped whenever the analysis itself changes. The cache
+* is stored in the project's saved folder and can be disabled with Validation.MeshAnalysisCache 0. Analyses unused for
+* Validation.MeshAnalysisCacheMaxAgeDays are evicted, as are the least recently used beyond
+* Validation.MeshAnalysisCacheMaxEntries. Each process writes its own file, such as each shard of a commandlet run, and
+* every file is merged on load, so concurrent processes never overwrite each other's analyses
+*/
+class VALIDATIONFRAMEWORK_API FValidationMeshAnalysisCache : public FNoncopyable
+{
+public:
+	struct FEntry
+	{
+		TArray<FValidationMeshLODFacts> LODs;
+
+		/**
+		* When the analysis was last added or found, in FDateTime ticks
+		*/
+		int64 LastUsedTicks = 0;
+	};
+
+	/**
+	* Gets the cache, loading it from disk the first time it is used
+	* @return The mesh analysis cache
+	*/
+	static FValidationMeshAnalysisCache& Get();
+
+	/**
+	* Gets the key the analysis of the given mesh is stored under
+	* @param StaticMesh - The mesh being analyzed
+	* @param bMeasureHalfPrecisionError - Whether the analysis measures half precision errors, which are kept apart
+	* @param UVLayoutChannelMask - The uv channels the analysis analyzes the layouts of, which are kept apart
+	* @return The cache key or an empty string if the mesh cannot be cached, such as when caching is disabled or the
+	* render data has no derived data key
+	*/
+	static FString GetCacheKey(const UStaticMesh* StaticMesh, const bool bMeasureHalfPrecisionError,
+		const uint32 UVLayoutChannelMask);
+
+	/**
+	* Finds a previous analysis, recording that it was used. Safe to call from any thread
+	* @param CacheKey - The key from GetCacheKey
+	* @param OutLODs - Receives the facts for each LOD of the mesh
+	* @return Whether the analysis was found
+	*/
+	bool Find(const FString& CacheKey, TArray<FValidationMeshLODFacts>& OutLODs);
+
+	/**
+	* Stores an analysis, which is written to disk on the next flush. Safe to call from any thread
+	* @param CacheKey - The key from GetCacheKey
+	* @param LODs - The facts for each LOD of the mesh
+	*/
+	void Add(const FString& CacheKey, const TArray<FValidationMeshLODFacts>& LODs);
+
+	/**
+	* Evicts unused analyses and writes the cache to this process's file if anything has been added or used since it was
+	* loaded, removing the files it was loaded from. Must be called on the game thread
+	*/
+	void Flush();
+
+private:
+	FValidationMeshAnalysisCache();
+
+	static FString GetCacheDirectory();
+
+	static void Serialize(FArchive& Ar, TMap<FString, FEntry>& InOutEntries);
+
+	/**
+	* Merges the entries of another cache file, keeping whichever of two entries for the same key was used last
+	*/
+	static void MergeEntries(TMap<FString, FEntry>& InOutEntries, TMap<FString, FEntry> OtherEntries);
+
+	/**
+	* Removes the entries which are too old, then the least recently used entries beyond the maximum count
+	*/
+	void EvictEntries();
+
+	TMap<FString, FEntry> Entries;
+	FRWLock EntriesLock;
+	bool bDirty = false;
+
+	/**
+	* The cache files which were merged on load and their timestamps, removed once their entries have been written
+	*/
+	TMap<FString, FDateTime> LoadedFiles;
+};
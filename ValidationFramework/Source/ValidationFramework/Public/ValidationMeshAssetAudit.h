@@ -0,0 +1,83 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "ValidationMeshAnalysis.h"
+
+/**
+* The facts about a mesh which UStaticMesh writes to its asset registry tags when saved, readable without loading it.
+* The uv channel, vertex and triangle counts are those of LOD 0 only
+*/
+struct FValidationMeshAssetTags
+{
+	int32 NumLODs = 0;
+	int32 NumUVChannels = 0;
+	int32 NumVertices = 0;
+	int32 NumTriangles = 0;
+
+	/**
+	* Reads the tags of a mesh asset
+	* @param AssetData - The asset data of the mesh
+	* @param OutTags - The tags which were read
+	* @return Whether every tag was present and describes built render data, so can be relied upon
+	*/
+	static bool Read(const FAssetData& AssetData, FValidationMeshAssetTags& OutTags);
+};
+
+/**
+* Audit of every mesh used by the nDisplay configs across the whole project, rather than just those in the open level.
+* Loading every mesh for this is slow and memory hungry, so each check is first asked whether it can be answered from
+* the asset registry tags of a mesh, and only the meshes whose tags cannot answer it are loaded and analyzed with
+* FValidationMeshAnalysis::AnalyzeMesh. Those meshes are loaded in bounded batches, and the audit releases its references
+* to each batch before loading the next, leaving it to the caller to collect garbage. As meshes are loaded this has to
+* run on the game thread
+*/
+class VALIDATIONFRAMEWORK_API FValidationMeshAssetAudit
+{
+public:
+	/**
+	* Checks the asset registry tags of a mesh
+	* @param Tags - The tags of the mesh
+	* @param PathName - The path of the mesh, for any messages
+	* @param OutStatus - The ValidationStatus of the mesh, when the tags answered the check
+	* @param Message - Any Messages which we want to store from within the validation
+	* @return Whether the tags answered the check, when they did not the mesh is loaded and checked in full
+	*/
+	typedef TFunctionRef<bool(const FValidationMeshAssetTags& Tags, const FString& PathName, EValidationStatus& OutStatus, FString& Message)> FTagCheck;
+
+	/**
+	* Finds the meshes referenced by every nDisplay config in the project, skipping those excluded by
+	* UValidationBPLibrary::GetNDisplayMeshExclusions. Does not wait for the asset registry, so only finds the configs
+	* and meshes discovered so far
+	* @param OutReferencers - The nDisplay configs referencing each mesh, keyed by the mesh package
+	* @return The asset data of every mesh found
+	*/
+	static TArray<FAssetData> FindNDisplayMeshAssets(TMap<FName, TArray<FString>>& OutReferencers);
+
+	/**
+	* Runs a check against every mesh used by the nDisplay configs in the project, combining the results in the same way
+	* as FValidationMeshAnalysis::Validate. Warns without checking anything while the asset registry is still discovering
+	* assets
+	* @param TagCheck - Answers the check from the asset registry tags of a mesh where it can
+	* @param Check - Checks the facts of a single LOD of a loaded mesh, for the meshes the tags could not answer
+	* @return The combined ValidationResult
+	*/
+	static FValidationResult Validate(FTagCheck TagCheck,
+		TFunctionRef<EValidationStatus(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message)> Check);
+};
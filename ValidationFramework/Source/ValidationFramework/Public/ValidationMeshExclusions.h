@@ -0,0 +1,91 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UActorComponent;
+class UStaticMesh;
+struct FAssetData;
+
+/**
+* The rules for which meshes within the nDisplay setups are not led walls and so are skipped by the mesh validations,
+* such as camera and origin meshes. Rules match a mesh by a prefix of its package path or by its name, or match a
+* component by any of its tags, and are set in the project settings. Stages can carry thousands of these helper meshes,
+* so the rules are compiled once per run into a hashed prefix trie and name sets, which are then matched without any
+* allocations
+*/
+class VALIDATIONFRAMEWORK_API FValidationMeshExclusions
+{
+public:
+	/**
+	* Compiles the rules, empty prefixes are ignored as they would exclude every mesh
+	* @param PackagePathPrefixes - Meshes whose package path starts with any of these are excluded, ignoring case
+	* @param MeshNames - Meshes with any of these names are excluded
+	* @param ComponentTags - Components with any of these tags are excluded
+	*/
+	FValidationMeshExclusions(TConstArrayView<FString> PackagePathPrefixes, TConstArrayView<FName> MeshNames, TConstArrayView<FName> ComponentTags);
+
+	/**
+	* Gets the rules set in the project settings, see UVFProjectSettingsEditor. The rules are compiled on first use and
+	* reused until InvalidateProjectSettings is called when the settings change
+	* @return The compiled rules
+	*/
+	static TSharedRef<const FValidationMeshExclusions> CompileProjectSettings();
+
+	/**
+	* Discards the rules compiled from the project settings, so they are compiled again on next use
+	*/
+	static void InvalidateProjectSettings();
+
+	/**
+	* @param StaticMesh - The mesh to match
+	* @return Whether the mesh is excluded by its package path or name
+	*/
+	bool IsMeshExcluded(const UStaticMesh* StaticMesh) const;
+
+	/**
+	* @param MeshAsset - The asset data of the mesh to match, so the mesh does not need to be loaded
+	* @return Whether the mesh is excluded by its package path or name
+	*/
+	bool IsMeshAssetExcluded(const FAssetData& MeshAsset) const;
+
+	/**
+	* @param Component - The component to match
+	* @return Whether the component is excluded by its tags, the mesh it uses is matched separately
+	*/
+	bool IsComponentExcluded(const UActorComponent* Component) const;
+
+private:
+	bool IsMeshExcluded(FName PackageName, FName MeshName) const;
+
+	static uint64 GetPrefixEdgeKey(int32 Node, TCHAR Character);
+
+	/**
+	* The edges of the prefix trie, keyed by the node they leave and the lower case character they follow, with the
+	* root at node 0
+	*/
+	TMap<uint64, int32> PrefixEdges;
+
+	/**
+	* Whether each node of the prefix trie ends a prefix
+	*/
+	TBitArray<> PrefixEnds;
+
+	TSet<FName> MeshNames;
+	TSet<FName> ComponentTags;
+};
@@ -0,0 +1,81 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+class UDisplayClusterConfigurationData;
+
+/**
+* A hashed index of the cluster node and viewport names of an nDisplay configuration, so the names which the OCIO and
+* color grading profiles refer to can each be checked in constant time however many viewports a cluster has. Names
+* are matched ignoring case, as nDisplay does
+*/
+class VALIDATIONFRAMEWORK_API FValidationNDisplayNameIndex
+{
+public:
+	FValidationNDisplayNameIndex() = default;
+
+	/**
+	* Indexes the cluster nodes and their viewports of the given configuration
+	* @param ConfigData - The configuration of an nDisplay root actor
+	*/
+	explicit FValidationNDisplayNameIndex(const UDisplayClusterConfigurationData& ConfigData);
+
+	/**
+	* @param NodeId - The name of a cluster node
+	* @return Whether the cluster has a node with the given name
+	*/
+	bool HasNode(const FString& NodeId) const { return Nodes.Contains(NodeId); }
+
+	/**
+	* @param ViewportId - The name of a viewport
+	* @return Whether any node of the cluster has a viewport with the given name
+	*/
+	bool HasViewport(const FString& ViewportId) const { return ViewportNodes.Contains(ViewportId); }
+
+	/**
+	* Finds the node owning a viewport
+	* @param ViewportId - The name of a viewport
+	* @return The name of the node owning the viewport or nullptr if there is no such viewport
+	*/
+	const FString* FindViewportNode(const FString& ViewportId) const { return ViewportNodes.Find(ViewportId); }
+
+	/**
+	* Finds the node name closest to one which does not exist, only run when a reference fails to resolve
+	* @param NodeId - The name which could not be found
+	* @return The closest node name, or an empty string if none is close enough to be a typo
+	*/
+	FString SuggestNode(const FString& NodeId) const;
+
+	/**
+	* Finds the viewport name closest to one which does not exist, only run when a reference fails to resolve
+	* @param ViewportId - The name which could not be found
+	* @return The closest viewport name, or an empty string if none is close enough to be a typo
+	*/
+	FString SuggestViewport(const FString& ViewportId) const;
+
+	/** The largest edit distance between a missing name and an existing one which is treated as a typo */
+	static constexpr int32 MaxTypoDistance = 3;
+
+private:
+	TSet<FString> Nodes;
+	TMap<FString, FString> ViewportNodes;
+	TArray<FString> Viewports;
+};
+#endif
@@ -0,0 +1,93 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OpenColorIOColorSpace.h"
+
+/**
+* How far apart two OCIO color conversions are over the sample colors, measured as delta E in CIELAB with the outputs
+* treated as linear Rec.709. Outputs are usually display encoded, so this is a numerical distance rather than a
+* perceptual one
+*/
+struct FValidationOCIOColorDifference
+{
+	/** Whether both conversions could be evaluated on the CPU */
+	bool bEvaluated = false;
+
+	/** The largest delta E over the finite samples */
+	float MaxDeltaE = 0.f;
+
+	/** The mean delta E over the finite samples */
+	float MeanDeltaE = 0.f;
+
+	/** The input color with the largest delta E */
+	FLinearColor WorstSample = FLinearColor::Black;
+
+	/** The number of samples either conversion turned into NaNs or infinities where the other did not */
+	int32 NumNonFiniteSamples = 0;
+};
+
+/**
+* Compares OCIO color conversions by what they do rather than how they are named. Each conversion is evaluated with
+* the OCIO CPU processor over a 33x33x33 lattice of the 0-1 RGB cube plus HDR ramps of neutral, red, green and blue,
+* so two configurations which are mathematically identical match even when named differently.
+* The samples are held as packed linear RGBA32F and transformed and compared in parallel batches
+*/
+class VALIDATIONFRAMEWORK_API FValidationOCIOEquivalence
+{
+public:
+	/** The number of lattice points along each axis of the RGB cube */
+	static constexpr int32 LatticeSize = 33;
+
+	/** The number of steps in each of the HDR ramps */
+	static constexpr int32 HDRRampSize = 64;
+
+	/** The number of samples transformed or compared by each parallel task */
+	static constexpr int32 BatchSize = 4096;
+
+	/**
+	* Gets the sample colors each conversion is evaluated on, built the first time they are asked for
+	* @return The lattice samples followed by the HDR ramp samples
+	*/
+	static TConstArrayView<FLinearColor> GetSamples();
+
+	/**
+	* Evaluates the given conversion on every sample with the OCIO CPU processor
+	* @param Settings - The OCIO color conversion to evaluate
+	* @param OutColors - The transformed samples, in the same order as GetSamples
+	* @return Whether the configuration asset could be loaded and the conversion evaluated
+	*/
+	static bool EvaluateSamples(const FOpenColorIOColorConversionSettings& Settings, TArray<FLinearColor>& OutColors);
+
+	/**
+	* Transforms the given colors in place with the OCIO CPU processor, in parallel batches
+	* @param Settings - The OCIO color conversion to apply
+	* @param InOutColors - The packed linear colors to transform
+	* @return Whether the configuration asset could be loaded and every color transformed
+	*/
+	static bool TransformColors(const FOpenColorIOColorConversionSettings& Settings, TArrayView<FLinearColor> InOutColors);
+
+	/**
+	* Measures the delta E between two sets of transformed samples, treating the transformed values as linear Rec.709
+	* whatever the destination encoding, so only conversions to the same destination are meaningfully compared
+	* @param ReferenceColors - The samples transformed by the reference conversion
+	* @param OtherColors - The same samples transformed by the conversion being compared
+	* @return The difference between the two, marked as evaluated
+	*/
+	static FValidationOCIOColorDifference CompareSamples(TConstArrayView<FLinearColor> ReferenceColors, TConstArrayView<FLinearColor> OtherColors);
+};
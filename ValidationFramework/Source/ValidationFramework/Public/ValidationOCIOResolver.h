@@ -0,0 +1,137 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OpenColorIOColorSpace.h"
+#include "ValidationOCIOEquivalence.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+
+/**
+* The outcome of resolving an OCIO color conversion against its configuration asset
+*/
+struct FValidationOCIOResolution
+{
+	/** Whether the configuration asset is set and has the source and destinations of the conversion */
+	bool bIsValid = false;
+
+	/** Identifies the distinct conversion within the resolver, conversions with the same id are identical */
+	int32 Id = INDEX_NONE;
+
+	/** The configuration asset the conversion resolved against */
+	FSoftObjectPath ConfigurationPath;
+};
+
+/**
+* Memoizes the resolution of OCIO color conversion settings for the duration of a validation run.
+* FOpenColorIOColorConversionSettings::IsValid looks up the configuration asset and its color spaces every time it is
+* called, whereas the nDisplay configs tend to share the same few conversions between all of their viewports and nodes.
+* Conversions are keyed by their configuration asset, source, destination and display/view so each distinct conversion
+* is only resolved once, as is the numerical evaluation of each conversion when those are compared numerically.
+* Configuration assets are UObjects so the resolver is only used from the game thread
+*/
+class VALIDATIONFRAMEWORK_API FValidationOCIOResolver : public FNoncopyable
+{
+public:
+	/**
+	* Resolves the given conversion, or returns the resolution of an identical conversion resolved earlier in the run
+	* @param Settings - The OCIO color conversion settings to resolve
+	* @return The resolution of the conversion
+	*/
+	FValidationOCIOResolution Resolve(const FOpenColorIOColorConversionSettings& Settings);
+
+	/**
+	* Gets the OCIO settings from the validation framework project settings, these are read and resolved the first time
+	* they are asked for and reused for the rest of the run
+	* @return The project OCIO settings or nullptr if the project has no validation framework settings
+	*/
+	const FOpenColorIOColorConversionSettings* GetProjectSettings();
+
+	/**
+	* Gets the resolution of the OCIO settings from the validation framework project settings
+	* @return The resolution of the project OCIO settings, which is not valid if the project has no settings
+	*/
+	FValidationOCIOResolution ResolveProjectSettings();
+
+	/**
+	* Gets the largest delta E which numerical comparisons of OCIO conversions allow, read from the validation
+	* framework project settings along with the project OCIO settings
+	* @return The largest delta E, or unset if conversions should be compared by name rather than numerically
+	*/
+	TOptional<float> GetMaxNumericalDeltaE();
+
+	/**
+	* Compares two conversions numerically, each distinct conversion is only evaluated once per run and each distinct
+	* pair is only compared once per run
+	* @param ReferenceSettings - The OCIO color conversion settings we are comparing with, such as the project settings
+	* @param OtherSettings - The OCIO color conversion settings we are comparing
+	* @return The difference between the two conversions, which is not evaluated if either could not be evaluated
+	*/
+	FValidationOCIOColorDifference CompareNumerically(
+		const FOpenColorIOColorConversionSettings& ReferenceSettings,
+		const FOpenColorIOColorConversionSettings& OtherSettings);
+
+private:
+	struct FConversionKey
+	{
+		FObjectKey Configuration;
+		FString SourceColorSpace;
+		FString DestinationColorSpace;
+		FString Display;
+		FString View;
+		bool bInverseDisplayView;
+
+		explicit FConversionKey(const FOpenColorIOColorConversionSettings& Settings);
+
+		bool operator==(const FConversionKey& Other) const
+		{
+			return Configuration == Other.Configuration
+				&& SourceColorSpace == Other.SourceColorSpace
+				&& DestinationColorSpace == Other.DestinationColorSpace
+				&& Display == Other.Display
+				&& View == Other.View
+				&& bInverseDisplayView == Other.bInverseDisplayView;
+		}
+
+		friend uint32 GetTypeHash(const FConversionKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.Configuration);
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.SourceColorSpace));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.DestinationColorSpace));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.Display));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.View));
+			return HashCombineFast(Hash, GetTypeHash(Key.bInverseDisplayView));
+		}
+	};
+
+	/**
+	* Evaluates the samples for a resolved conversion, or returns those evaluated earlier in the run
+	* @return The transformed samples, empty if the conversion could not be evaluated
+	*/
+	const TArray<FLinearColor>& EvaluateSamples(const FOpenColorIOColorConversionSettings& Settings, int32 ResolutionId);
+
+	void ReadProjectSettings();
+
+	TMap<FConversionKey, FValidationOCIOResolution> Resolutions;
+	TMap<int32, TArray<FLinearColor>> EvaluatedSamples;
+	TMap<TPair<int32, int32>, FValidationOCIOColorDifference> Differences;
+
+	TOptional<FOpenColorIOColorConversionSettings> ProjectSettings;
+	TOptional<float> MaxNumericalDeltaE;
+	bool bProjectSettingsRead = false;
+};
@@ -0,0 +1,289 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "Modules/ModuleManager.h"
+#include "ValidationRegistrySubsystem.generated.h"
+
+struct FAssetData;
+class UValidationBase;
+
+/**
+* Delegate broadcast when blueprint validations are discovered whilst the asset registry is still loading
+*/
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnValidationsDiscovered, const TArray<UObject*>& /*NewValidations*/);
+
+/**
+* Editor subsystem which owns the registry of all known validations, both those implemented in c++ and those
+* implemented via blueprints. The registry is built lazily the first time it is queried and is then served from memory,
+* the asset registry, module and hot reload delegates mark the relevant part of the registry as dirty so that it is
+* only rebuilt when validations could actually have changed
+*/
+UCLASS()
+class VALIDATIONFRAMEWORK_API UValidationRegistrySubsystem final : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	* Convenience accessor for the registry from static contexts such as the blueprint library
+	* @return The registry subsystem or nullptr if the editor is not available
+	*/
+	static UValidationRegistrySubsystem* Get();
+
+	/**
+	* Gets all of the validations which are defined in code or via blueprint, rebuilding the registry if needed
+	* @return An array of UObjects representing all of the validations in the project
+	*/
+	TArray<UObject*> GetAllValidations();
+
+	/**
+	* Gets all of the validations which are defined in C++, rebuilding this part of the registry if needed
+	* @return An array of UObjects representing all of the C++ validations in the project
+	*/
+	TArray<UObject*> GetCodeValidations();
+
+	/**
+	* Gets all of the validations which are defined via blueprints, rebuilding this part of the registry if needed
+	* @return An array of UObjects representing all of the blueprint validations in the project
+	*/
+	TArray<UObject*> GetBlueprintValidations();
+
+	/**
+	* Gets the validations which apply to any of the given workflows and any of the given scopes. The per validation
+	* masks are computed once when the registry is built and each distinct query is cached, so repeated queries do
+	* no filtering at all
+	* @param WorkflowMask - Mask of the workflows to match, see ValidationWorkflowToMask
+	* @param ScopeMask - Mask of the scopes to match, see ValidationScopeToMask
+	* @return The matching validations sorted by name, the array remains valid until the registry is next rebuilt
+	*/
+	const TArray<UValidationBase*>& GetValidations(uint32 WorkflowMask, uint32 ScopeMask);
+
+	/**
+	* Gets all of the validations once blueprint discovery has completed without blocking the caller, if the asset
+	* registry has already finished loading the future is fulfilled immediately
+	* @return A future which is fulfilled on the game thread with all of the validations in the project
+	*/
+	TFuture<TArray<UObject*>> RequestAllValidations();
+
+	/**
+	* Whether the asset registry is still discovering assets, in which case blueprint validations are still being
+	* added to the registry as they are found
+	* @return True whilst blueprint validations are still being discovered
+	*/
+	bool IsDiscoveringValidations() const;
+
+	/**
+	* Marks the entire registry as dirty so the next query rebuilds it from scratch
+	*/
+	void InvalidateRegistry();
+
+	/**
+	* Broadcast as blueprint validations are found during asset discovery, allowing UIs to populate incrementally
+	*/
+	FOnValidationsDiscovered OnValidationsDiscovered;
+
+private:
+	/**
+	* Walks all of the native classes deriving from UValidationBase and stores their default objects
+	*/
+	void RebuildCodeValidations();
+
+	/**
+	* Queries the asset registry for all of the blueprints deriving from UValidationBase and stores their default objects,
+	* the blueprint classes are loaded as a single batch which we wait on
+	*/
+	void RebuildBlueprintValidations();
+
+	/**
+	* Brings the blueprint validations up to date for a synchronous query, rebuilding them when they are dirty and
+	* otherwise merging in any validations discovered whilst the asset registry is still loading
+	*/
+	void UpdateBlueprintValidations();
+
+	/**
+	* Loads the validations discovered whilst the asset registry is loading which have not yet been added to the
+	* registry, waiting on any already loading, then marks the blueprint validations as up to date
+	*/
+	void MergeDiscoveredBlueprints();
+
+	/**
+	* Queries the asset registry for all of the blueprints deriving from UValidationBase and requests their classes as a
+	* single asynchronous batch, the registry is updated and pending requests fulfilled once the batch has loaded
+	*/
+	void RebuildBlueprintValidationsAsync();
+
+	/**
+	* Queries the asset registry for the generated classes of all blueprints deriving from UValidationBase
+	* @return The object paths of the blueprint validation classes
+	*/
+	TArray<FSoftObjectPath> GatherBlueprintValidationClassPaths();
+
+	/**
+	* Requests the given blueprint validation classes be loaded in one batch via the streamable manager
+	* @param ClassPaths - The generated classes we want to load
+	* @param OnLoaded - Called once all of the classes have loaded
+	* @return The handle for the batch, or nullptr if there was nothing to load
+	*/
+	TSharedPtr<FStreamableHandle> RequestBlueprintClassLoad(const TArray<FSoftObjectPath>& ClassPaths, FStreamableDelegate OnLoaded);
+
+	/**
+	* Adds the default objects of the given loaded classes to the registry, holding onto the classes so they are not
+	* garbage collected and reloaded between runs
+	* @param ClassPaths - The generated classes which have been loaded
+	* @param OutNewValidations - Optionally receives the validations which were not already in the registry
+	*/
+	void AddBlueprintValidationClasses(const TArray<FSoftObjectPath>& ClassPaths, TArray<UObject*>* OutNewValidations);
+
+	void OnBlueprintRebuildLoaded(TArray<FSoftObjectPath> ClassPaths, uint32 Generation);
+	void OnDiscoveredBlueprintsLoaded(TArray<FSoftObjectPath> ClassPaths, uint32 Generation);
+
+	/**
+	* Computes the workflow and scope masks for every validation and sorts them into a stable order, clearing any
+	* cached queries
+	*/
+	void RebuildValidationIndex();
+
+	/**
+	* Whether the given asset is a blueprint which could generate a validation class
+	* @param AssetData - The asset reported by the asset registry
+	* @return Whether the asset could affect the blueprint validations in the registry
+	*/
+	static bool IsPotentialValidationBlueprint(const FAssetData& AssetData);
+
+	/**
+	* Whether the given asset is a blueprint whose native parent derives from UValidationBase and which lives in one of
+	* the validation content paths, this only reads asset registry tags so never loads the asset
+	* @param AssetData - The asset reported by the asset registry
+	* @return Whether the asset generates a validation class
+	*/
+	bool IsValidationBlueprint(const FAssetData& AssetData) const;
+
+	/**
+	* Gets the content paths which are searched for blueprint validations, an empty array means all content
+	* @return The long package paths of the validation content roots
+	*/
+	static TArray<FString> GetValidationContentPaths();
+
+	/**
+	* Loads any blueprint validations discovered since the last flush and broadcasts them
+	* @param DeltaTime - Unused time since the ticker was registered
+	* @return False so the ticker only fires once
+	*/
+	bool FlushDiscoveredBlueprints(float DeltaTime);
+
+	/**
+	* Fulfills any outstanding asynchronous requests with the now complete registry
+	*/
+	void FulfillPendingRequests();
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnFilesLoaded();
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void OnReloadComplete(EReloadCompleteReason Reason);
+	void OnBlueprintCompiled();
+
+	/**
+	* The default objects of all of the validations implemented in c++
+	*/
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> CodeValidations;
+
+	/**
+	* The default objects of all of the validations implemented via blueprints
+	*/
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> BlueprintValidations;
+
+	/**
+	* The loaded blueprint validation classes, referencing them here keeps them rooted for the lifetime of the editor
+	* so repeated runs never have to reload them after garbage collection
+	*/
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UClass>> BlueprintValidationClasses;
+
+	/**
+	* A validation along with its precomputed workflow and scope masks
+	*/
+	struct FValidationIndexEntry
+	{
+		UValidationBase* Validation = nullptr;
+		uint32 WorkflowMask = 0;
+		uint32 ScopeMask = 0;
+	};
+
+	/**
+	* Every validation in the registry sorted by name, so filtered queries are sorted for free
+	*/
+	TArray<FValidationIndexEntry> ValidationIndex;
+
+	/**
+	* Results of previous queries keyed by their scope and workflow masks, the arrays are heap allocated so references
+	* handed out stay valid as further queries are added
+	*/
+	TMap<uint64, TUniquePtr<TArray<UValidationBase*>>> ValidationQueryCache;
+
+	bool bCodeValidationsDirty = true;
+	bool bBlueprintValidationsDirty = true;
+	bool bValidationIndexDirty = true;
+
+	/**
+	* Incremented every time a full blueprint rebuild starts so that superseded asynchronous loads are ignored
+	*/
+	uint32 BlueprintRebuildGeneration = 0;
+
+	/**
+	* Streamable manager used to batch load the blueprint validation classes
+	*/
+	FStreamableManager StreamableManager;
+
+	/**
+	* Handles for the batched loads which are still in flight
+	*/
+	TArray<TSharedPtr<FStreamableHandle>> BlueprintClassHandles;
+
+	/**
+	* The generated class paths of validation blueprints discovered whilst the asset registry is loading
+	*/
+	TArray<FSoftObjectPath> DiscoveredBlueprintClassPaths;
+
+	/**
+	* Requests waiting for blueprint discovery to complete
+	*/
+	TArray<TPromise<TArray<UObject*>>> PendingRequests;
+
+	/**
+	* Cached validation content roots, refreshed whenever the blueprint validations are rebuilt
+	*/
+	TArray<FString> ContentPaths;
+
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
@@ -0,0 +1,176 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationCommon.h"
+#include "ValidationWorldSnapshot.h"
+#include "HAL/Event.h"
+
+#include <atomic>
+
+class FValidationMeshAnalysis;
+class FValidationMeshExclusions;
+class FValidationOCIOResolver;
+class UValidationBase;
+
+/**
+* State shared between all of the validations within a single run, such as generating a report or running all of the
+* validations from the UI. Constructing a run context makes it the active run until it is destroyed, validations then
+* query it through FValidationRunContext::Get() rather than each gathering the same data from the world themselves.
+* The results of each validation and fix are memoized for the duration of the run, so validations which depend on one
+* another or fixes which re-run their validation never repeat the same checks
+*/
+class VALIDATIONFRAMEWORK_API FValidationRunContext : public FNoncopyable
+{
+public:
+	/**
+	* Starts a new run against the given world, making this the active run context
+	* @param InWorld - The world the validations in this run are checking
+	*/
+	explicit FValidationRunContext(UWorld* InWorld);
+	~FValidationRunContext();
+
+	/**
+	* Gets the active run context
+	* @return The active run context or nullptr if no validation run is in progress
+	*/
+	static FValidationRunContext* Get();
+
+	/**
+	* Gets the world the validations in this run are checking
+	* @return The world or nullptr if it has since been destroyed
+	*/
+	UWorld* GetWorld() const;
+
+	/**
+	* Gets the snapshot of all of the actors and components in the world, the snapshot is taken when the run starts and
+	* is retaken on the game thread if actors have been added or removed since, for example by a fix. Validations still
+	* holding an earlier snapshot keep it alive until they are done with it
+	* @return The world snapshot for this run
+	*/
+	TSharedRef<const FValidationWorldSnapshot> GetWorldSnapshot();
+
+	/**
+	* Gets the analysis of the meshes used by the nDisplay setups in the world, built by whichever mesh validation asks
+	* first and then shared by the rest of the run. Like the world snapshot it is rebuilt on the game thread if actors
+	* have been added or removed since, and also after any fix or if it is asked for uv layouts it was not built with. The
+	* analysis reads the meshes, so it can only be built on the game thread
+	* @param UVLayoutChannelMask - The uv channels the caller needs the layouts of, one bit per channel
+	* @return The mesh analysis for this run
+	*/
+	TSharedRef<const FValidationMeshAnalysis> GetMeshAnalysis(const uint32 UVLayoutChannelMask = 0);
+
+	/**
+	* Gets the rules for which meshes within the nDisplay setups are not led walls, compiled from the project settings
+	* once when the run starts
+	* @return The compiled exclusion rules for this run
+	*/
+	TSharedRef<const FValidationMeshExclusions> GetMeshExclusions() const { return MeshExclusions; }
+
+	/**
+	* Gets the resolver which memoizes the OCIO color conversions resolved within this run, including the OCIO settings
+	* from the project settings
+	* @return The OCIO resolver for this run
+	*/
+	TSharedRef<FValidationOCIOResolver> GetOCIOResolver() const { return OCIOResolver; }
+
+	/**
+	* Runs the given validation, or returns its result if it has already been run within this run. Validations which
+	* are not thread safe can only be run for the first time on the game thread
+	* @param Validation - The validation to run
+	* @return The result of the validation
+	*/
+	FValidationResult RunValidation(UValidationBase* Validation);
+
+	/**
+	* Seeds the run with a result which is already known, such as a project validation which was run once for a
+	* batch of levels, so validations depending on it reuse the result rather than running it again
+	* @param Validation - The validation the result belongs to
+	* @param Result - The result of the validation
+	*/
+	void AddValidationResult(const UValidationBase* Validation, const FValidationResult& Result);
+
+	/**
+	* Runs the fix for the given validation, or returns its result if it has already been fixed within this run. Once
+	* fixed, the memoized results of the validation and any validations which depend on it are discarded, and the mesh
+	* analysis is rebuilt the next time it is asked for
+	* @param Validation - The validation to fix
+	* @return The result of the fix
+	*/
+	FValidationFixResult RunFix(UValidationBase* Validation);
+
+private:
+	/**
+	* A memoized validation result. The lock only guards the memo itself and is released whilst the validation runs,
+	* concurrent requests wait on the event until the result is published
+	*/
+	struct FValidationMemo
+	{
+		FCriticalSection Lock;
+		TOptional<FValidationResult> Result;
+		bool bRunning = false;
+		FEventRef Done = FEventRef(EEventMode::ManualReset);
+	};
+
+	TSharedRef<FValidationMemo> FindOrAddValidationMemo(const UClass* ValidationClass);
+
+	/**
+	* Records that the calling thread is about to wait for a validation running on another thread, unless that would
+	* close a cycle of threads each waiting for a validation the next one is running
+	* @param ValidationClass - The class of the validation to wait for
+	* @param ThreadId - The calling thread
+	* @return Whether it is safe to wait, false when the validations depend on each other
+	*/
+	bool BeginWaitingForValidation(const UClass* ValidationClass, uint32 ThreadId);
+	void EndWaitingForValidation(uint32 ThreadId);
+
+	/**
+	* Discards the memoized result of the given validation and of every validation which depends on it
+	* @param ValidationClass - The class of the validation whose state has changed
+	*/
+	void InvalidateValidationResult(const UClass* ValidationClass);
+
+	void OnLevelActorsChanged(AActor* Actor);
+
+	TMap<const UClass*, TSharedRef<FValidationMemo>> ValidationMemos;
+	FCriticalSection ValidationMemosLock;
+	TMap<const UClass*, FValidationFixResult> FixResults;
+
+	/** The thread running each validation and the validation each waiting thread is waiting for */
+	TMap<const UClass*, uint32> RunningThreads;
+	TMap<uint32, const UClass*> WaitingThreads;
+	FCriticalSection RunningThreadsLock;
+
+	TWeakObjectPtr<UWorld> World;
+	TSharedPtr<const FValidationWorldSnapshot> WorldSnapshot;
+	FCriticalSection WorldSnapshotLock;
+	std::atomic<bool> bWorldSnapshotDirty = false;
+
+	TSharedRef<const FValidationMeshExclusions> MeshExclusions;
+	TSharedPtr<const FValidationMeshAnalysis> MeshAnalysis;
+	FCriticalSection MeshAnalysisLock;
+	std::atomic<bool> bMeshAnalysisDirty = false;
+
+	TSharedRef<FValidationOCIOResolver> OCIOResolver;
+
+	FValidationRunContext* PreviousContext = nullptr;
+	FDelegateHandle LevelActorAddedHandle;
+	FDelegateHandle LevelActorDeletedHandle;
+
+	static FValidationRunContext* ActiveContext;
+};
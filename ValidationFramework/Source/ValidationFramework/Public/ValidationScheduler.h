@@ -0,0 +1,57 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationCommon.h"
+
+class FValidationRunContext;
+class UValidationBase;
+
+/**
+* Runs batches of validations, those which declare themselves safe to run on any thread are dispatched to the task graph
+* whilst the rest are run one after another on the game thread. Results are always returned in the same order as the
+* validations passed in, so reports are deterministic regardless of how the work was scheduled. The validations are run
+* within the active FValidationRunContext, or a new one if there is none, so each validation is only run once
+*/
+class VALIDATIONFRAMEWORK_API FValidationScheduler
+{
+public:
+	/**
+	* Runs all of the given validations, blocking until they have all completed. Must be called from the game thread
+	* @param Validations - The validations to run
+	* @return The result of each validation, at the same index as the validation it belongs to
+	*/
+	static TArray<FValidationResult> RunValidations(const TArray<UValidationBase*>& Validations);
+
+	/**
+	* Runs the fixes for all of the given validations one after another on the game thread, fixes shared through
+	* dependencies are only applied once
+	* @param Validations - The validations to fix
+	* @return The result of each fix, at the same index as the validation it belongs to
+	*/
+	static TArray<FValidationFixResult> RunFixes(const TArray<UValidationBase*>& Validations);
+
+private:
+	/**
+	* Runs any dependencies of the given validation which cannot be run away from the game thread, so that their
+	* results are memoized before the validation is dispatched to a worker thread
+	* @param RunContext - The run the validation is part of
+	* @param Validation - The validation about to be dispatched
+	*/
+	static void RunGameThreadDependencies(FValidationRunContext& RunContext, const UValidationBase* Validation);
+};
@@ -0,0 +1,95 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FStaticMeshVertexBuffer;
+struct FVector2DHalf;
+
+/**
+* The bounds of one uv channel across every vertex of a mesh LOD
+*/
+struct FValidationUVChannelBounds
+{
+	FVector2f Min = FVector2f(MAX_flt, MAX_flt);
+	FVector2f Max = FVector2f(-MAX_flt, -MAX_flt);
+
+	/**
+	* The number of vertices whose uv in this channel lies outside of 0-1, or is not a number
+	*/
+	uint32 NumOutOfRange = 0;
+};
+
+/**
+* Vectorized computation of per channel uv bounds directly over the raw texture coordinate data of a static mesh vertex
+* buffer, in either its half or full precision layout. The uvs of every channel are stored interleaved per vertex, so
+* the data is streamed four floats at a time and the channels each register belongs to repeat with a fixed period,
+* letting every position in that period accumulate into its own registers with no per vertex gathering or branching
+*/
+class VALIDATIONFRAMEWORK_API FValidationUVBounds
+{
+public:
+	/**
+	* The most uv channels a static mesh can have
+	*/
+	static constexpr uint32 MaxChannels = 8;
+
+	/**
+	* Computes the bounds of every uv channel held by the vertex buffer
+	* @param VertexBuffer - The vertex buffer of a static mesh LOD
+	* @param OutChannels - The bounds of each channel
+	* @return False if the vertex buffer has no CPU copy of its texture coordinates
+	*/
+	static bool Compute(const FStaticMeshVertexBuffer& VertexBuffer, TArray<FValidationUVChannelBounds>& OutChannels);
+
+	/**
+	* Computes the bounds of full precision uvs
+	* @param UVs - The uvs of every channel interleaved per vertex
+	* @param NumVertices - The number of vertices
+	* @param NumChannels - The number of uv channels per vertex
+	* @param OutChannels - Receives the bounds of each channel, must hold NumChannels entries
+	*/
+	static void ComputeFloat(const FVector2f* UVs, uint32 NumVertices, uint32 NumChannels, TArrayView<FValidationUVChannelBounds> OutChannels);
+
+	/**
+	* Computes the bounds of half precision uvs, converting them in small chunks so no full precision copy is made
+	* @param UVs - The uvs of every channel interleaved per vertex
+	* @param NumVertices - The number of vertices
+	* @param NumChannels - The number of uv channels per vertex
+	* @param OutChannels - Receives the bounds of each channel, must hold NumChannels entries
+	*/
+	static void ComputeHalf(const FVector2DHalf* UVs, uint32 NumVertices, uint32 NumChannels, TArrayView<FValidationUVChannelBounds> OutChannels);
+
+	/**
+	* Computes how far converting the uvs held by the vertex buffer to half precision would move them
+	* @param VertexBuffer - The vertex buffer of a static mesh LOD
+	* @param OutMaxErrors - The largest change in u and v of each channel
+	* @return False if the vertex buffer has no CPU copy of full precision texture coordinates to measure against
+	*/
+	static bool ComputeHalfPrecisionError(const FStaticMeshVertexBuffer& VertexBuffer, TArray<FVector2f>& OutMaxErrors);
+
+	/**
+	* Computes how far converting full precision uvs to half precision would move them, round tripping four floats at
+	* a time through the same conversion used to build half precision vertex buffers
+	* @param UVs - The uvs of every channel interleaved per vertex
+	* @param NumVertices - The number of vertices
+	* @param NumChannels - The number of uv channels per vertex
+	* @param OutMaxErrors - Receives the largest change in u and v of each channel, must hold NumChannels entries
+	*/
+	static void ComputeHalfPrecisionErrorFloat(const FVector2f* UVs, uint32 NumVertices, uint32 NumChannels, TArrayView<FVector2f> OutMaxErrors);
+};
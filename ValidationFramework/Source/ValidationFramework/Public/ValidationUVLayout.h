@@ -0,0 +1,70 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FIndexArrayView;
+
+/**
+* The layout of one uv channel of a mesh LOD
+*/
+struct FValidationUVLayoutFacts
+{
+	/**
+	* The number of separate uv islands, triangles sharing a uv position belong to the same island
+	*/
+	uint32 NumIslands = 0;
+
+	/**
+	* The number of triangles wound the opposite way in uv space to the majority of the mesh, by area
+	*/
+	uint32 NumFlippedTriangles = 0;
+
+	/**
+	* The fraction of 0-1 uv space covered by at least one triangle
+	*/
+	float CoveredArea = 0.0f;
+
+	/**
+	* The fraction of 0-1 uv space covered by more than one triangle
+	*/
+	float OverlapArea = 0.0f;
+};
+
+/**
+* Analyzes the layout of a uv channel by rasterizing every triangle into a coverage grid over 0-1 uv space. Triangles
+* are rasterized in fixed point with a top left fill rule, so triangles which only share an edge never count as
+* overlapping, whilst any triangles stacked on top of one another, such as mirrored or duplicated islands, do. Islands
+* are found by welding vertices with identical uvs and joining the triangles which share them
+*/
+class VALIDATIONFRAMEWORK_API FValidationUVLayout
+{
+public:
+	/**
+	* The width and height of the coverage grid, each cell is roughly a texel of a 1k texture
+	*/
+	static constexpr int32 GridResolution = 1024;
+
+	/**
+	* Analyzes the layout of a single uv channel
+	* @param UVs - The uv of each vertex in the channel
+	* @param Indices - The triangle list indexing into the uvs
+	* @return The layout facts for the channel
+	*/
+	static FValidationUVLayoutFacts Analyze(TConstArrayView<FVector2f> UVs, const FIndexArrayView& Indices);
+};
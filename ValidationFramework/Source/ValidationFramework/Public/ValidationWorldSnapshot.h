@@ -0,0 +1,137 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Class.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UActorComponent;
+
+/**
+* Buckets all of the actors in a world, along with their components, by class in a single pass so that the validations
+* within a run can query them without each walking the entire world. Queries for a base class are merged from the
+* buckets of its derived classes the first time they are made and then cached. The snapshot must be built on the game
+* thread but can then be queried from any thread
+*/
+class VALIDATIONFRAMEWORK_API FValidationWorldSnapshot : public FNoncopyable
+{
+public:
+	/**
+	* Walks the given world once, bucketing every actor and component by its class
+	* @param InWorld - The world to snapshot
+	*/
+	explicit FValidationWorldSnapshot(UWorld* InWorld);
+
+	/**
+	* Gets the world the snapshot was taken from
+	* @return The world or nullptr if it has since been destroyed
+	*/
+	UWorld* GetWorld() const;
+
+	/**
+	* Gets all of the actors of the given class or any of its subclasses, in the same order as UGameplayStatics::GetAllActorsOfClass
+	* @param ActorClass - The class of actor to get
+	* @return The matching actors
+	*/
+	const TArray<AActor*>& GetActorsOfClass(const UClass* ActorClass) const;
+
+	/**
+	* Gets all of the components of the given class or any of its subclasses, across all of the actors in the world
+	* @param ComponentClass - The class of component to get
+	* @return The matching components
+	*/
+	const TArray<UActorComponent*>& GetComponentsOfClass(const UClass* ComponentClass) const;
+
+	/**
+	* Gets the number of actors in the snapshot
+	* @return The number of actors which were found in the world
+	*/
+	int32 GetNumActors() const;
+
+private:
+	/**
+	* Objects bucketed by their exact class, along with the cached results of queries for base classes
+	*/
+	template <typename ObjectType>
+	struct TClassBuckets
+	{
+		/** All of the objects in world iteration order */
+		TArray<ObjectType*> Objects;
+
+		/** Indices into Objects for each exact class */
+		TMap<const UClass*, TArray<int32>> IndicesByClass;
+
+		/** Results of previous queries, heap allocated so references stay valid as more queries are cached */
+		mutable TMap<const UClass*, TUniquePtr<TArray<ObjectType*>>> QueryCache;
+		mutable FRWLock QueryLock;
+
+		void Add(ObjectType* Object)
+		{
+			IndicesByClass.FindOrAdd(Object->GetClass()).Add(Objects.Add(Object));
+		}
+
+		const TArray<ObjectType*>& Query(const UClass* Class) const
+		{
+			static const TArray<ObjectType*> Empty;
+			if (Class == nullptr)
+			{
+				return Empty;
+			}
+
+			{
+				FReadScopeLock ReadLock(QueryLock);
+				if (const TUniquePtr<TArray<ObjectType*>>* Cached = QueryCache.Find(Class))
+				{
+					return **Cached;
+				}
+			}
+
+			FWriteScopeLock WriteLock(QueryLock);
+			if (const TUniquePtr<TArray<ObjectType*>>* Cached = QueryCache.Find(Class))
+			{
+				return **Cached;
+			}
+
+			TArray<int32> Indices;
+			for (const TPair<const UClass*, TArray<int32>>& Bucket : IndicesByClass)
+			{
+				if (Bucket.Key->IsChildOf(Class))
+				{
+					Indices.Append(Bucket.Value);
+				}
+			}
+
+			// Merging buckets loses the world order so restore it, this keeps results identical to an actor walk
+			Indices.Sort();
+
+			TUniquePtr<TArray<ObjectType*>> Result = MakeUnique<TArray<ObjectType*>>();
+			Result->Reserve(Indices.Num());
+			for (const int32 Index : Indices)
+			{
+				Result->Add(Objects[Index]);
+			}
+			return *QueryCache.Add(Class, MoveTemp(Result));
+		}
+	};
+
+	TWeakObjectPtr<UWorld> World;
+	TClassBuckets<AActor> Actors;
+	TClassBuckets<UActorComponent> Components;
+};
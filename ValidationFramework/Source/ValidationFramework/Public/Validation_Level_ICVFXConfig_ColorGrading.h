@@ -21,6 +21,7 @@ limitations under the License.
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 #include "DisplayClusterConfigurationTypes_ICVFX.h"
 #include "DisplayClusterRootActor.h"
+#include "Components/DisplayClusterICVFXCameraComponent.h"
 #endif
 #include "Validation_Level_ICVFXConfig_ColorGrading.generated.h"
 
@@ -51,31 +52,35 @@ public:
 	*/
 	static void ValidateEntireClusterColorGrading(
 		FValidationResult& Result, FString& ActorMessages,
-		FDisplayClusterConfigurationICVFX_StageSettings StageSettings);
+		const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings);
 
 	/**
-	* Validates the color grading settings which are set per viewport, this includes the exposure settings, blue correction
+	* Validates the color grading settings of a single viewport, this includes the exposure settings, blue correction
 	* and expand gamut.
 	* @param Result - The validation result object we want to collect the results in
 	* @param ActorMessages - The overall collection of all the messages returned from the validations.
-	* @param StageSettings - The stage settings from the NDisplay actor and ICVFX camera
+	* @param x - The index of the per viewport color grading within the stage settings
+	* @param PerViewportColorGrading - The per viewport color grading from the NDisplay actor stage settings
 	*/
-	void ValidatePerViewPortColorGrading(
+	static void ValidatePerViewportColorGrading(
 		FValidationResult& Result,
 		FString& ActorMessages,
-		FDisplayClusterConfigurationICVFX_StageSettings StageSettings) const;
+		int32 x,
+		const FDisplayClusterConfigurationViewport_PerViewportColorGrading& PerViewportColorGrading);
 
 	/**
-	* Validates the color grading settings for the inner frustum, this includes the blue correction
+	* Validates the color grading settings for the inner frustum of an ICVFX camera, this includes the blue correction
 	* and expand gamut.
 	* @param Result - The validation result object we want to collect the results in
 	* @param ActorMessages - The overall collection of all the messages returned from the validations.
-	* @param Actor - The Actor representing the NDisplay setup that we need to validate
+	* @param IcvfxCameraComponent - The ICVFX camera we need to validate
+	* @param CameraSettings - The settings of the ICVFX camera
 	*/	
-	void ValidateInnerFrustumColorGrading(
+	static void ValidateInnerFrustumColorGrading(
 		FValidationResult& Result,
 		FString& ActorMessages,
-		const ADisplayClusterRootActor* Actor) const;
+		const UDisplayClusterICVFXCameraComponent& IcvfxCameraComponent,
+		const FDisplayClusterConfigurationICVFX_CameraSettings& CameraSettings);
 
 	/**
 	* Fixes the color grading settings for the whole cluster, this includes the blue correction
@@ -0,0 +1,39 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationBase.h"
+#include "Validation_Level_NDisplay_ColorPipeline.generated.h"
+
+/**
+* Validation which predicts how far the output of each wall node and inner frustum strays from the project color
+* pipeline. The post processing and OCIO validations each check a single setting, this simulates the whole chain on the
+* CPU, the post process volumes of the level and the nDisplay color grading, followed by the OCIO transform resolved for
+* each viewport, and compares it against the project OCIO transform alone
+*/
+UCLASS()
+class VALIDATIONFRAMEWORK_API UValidation_Level_NDisplay_ColorPipeline final : public UValidationBase
+{
+	GENERATED_BODY()
+public:
+	UValidation_Level_NDisplay_ColorPipeline();
+
+	virtual FValidationResult Validation_Implementation() override;
+
+	virtual FValidationFixResult Fix_Implementation() override;
+};
@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 #include "CoreMinimal.h"
 #include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
 #include "Validation_Level_NDisplay_Mesh_2UVChannels.generated.h"
 
 /**
@@ -38,13 +39,13 @@ public:
 
 	/**
 	* Function to run the actual validation to check the mesh has exactly 2 uv channels.
-	* This function is passed to a generic NDisplay mesh validation. 
-	* @param StaticMesh - The mesh we want to validate
+	* This function is run against the shared NDisplay mesh analysis. 
+	* @param MeshFacts - The analysis of the mesh we want to validate
 	* @param LodIndex - The lod of the static mesh that we want to validate
 	* @param Message - Any Messages which we want to store from within the validation
 	* @return The ValidationStatus of the actual check.
 	*/
-	static EValidationStatus ValidateMeshesWithout2UVChannels(UStaticMesh* StaticMesh, const int LodIndex, FString& Message);
+	static EValidationStatus ValidateMeshesWithout2UVChannels(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message);
 
 };
 
@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 #include "CoreMinimal.h"
 #include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
 #include "Validation_Level_NDisplay_Mesh_FullPrecisionUVs.generated.h"
 
 /**
@@ -36,13 +37,34 @@ public:
 
 	/**
 	* Function to run the actual validation to check the mesh is using full precision uvs.
-	* This function is passed to a generic NDisplay mesh validation. 
-	* @param StaticMesh - The mesh we want to validate
+	* This function is run against the shared NDisplay mesh analysis. 
+	* @param MeshFacts - The analysis of the mesh we want to validate
 	* @param LodIndex - The lod of the static mesh that we want to validate
 	* @param Message - Any Messages which we want to store from within the validation
 	* @return The ValidationStatus of the actual check.
 	*/
-	static EValidationStatus ValidateFullPrecisionUVs(UStaticMesh* StaticMesh, const int LodIndex, FString& Message);
+	static EValidationStatus ValidateFullPrecisionUVs(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message);
+
+	/**
+	* Function to run the validation when the project settings measure the uv half precision error, only failing meshes
+	* without full precision uvs when half precision moves their uvs by a visible amount on the LED processors.
+	* Falls back to ValidateFullPrecisionUVs when there were no full precision uvs to measure against
+	* @param MeshFacts - The analysis of the mesh we want to validate
+	* @param LodIndex - The lod of the static mesh that we want to validate
+	* @param ProcessorResolution - The resolution the LED processors map the 0-1 uv space onto
+	* @param MaxErrorTexels - The largest error in processor texels which is allowed
+	* @param Message - Any Messages which we want to store from within the validation
+	* @return The ValidationStatus of the actual check.
+	*/
+	static EValidationStatus ValidateHalfPrecisionUVError(const FValidationMeshFacts& MeshFacts, const int LodIndex,
+		const FIntPoint& ProcessorResolution, const float MaxErrorTexels, FString& Message);
+
+	/**
+	* Runs whichever check the project settings ask for against the NDisplay meshes in the world
+	* @param World - The UWorld we are operating within
+	* @return The combined ValidationResult
+	*/
+	static FValidationResult ValidateNDisplayMeshes(const UWorld* World);
 	
 };
 
@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 #include "CoreMinimal.h"
 #include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
 #include "Validation_Level_NDisplay_Mesh_LightmapUVs.generated.h"
 
 /**
@@ -36,11 +37,11 @@ public:
 
 	/**
 	* Function to run the actual validation check for ensuring that light map generation is disabled.
-	* This function is passed to a generic NDisplay mesh validation. 
-	* @param StaticMesh - The mesh we want to validate
+	* This function is run against the shared NDisplay mesh analysis. 
+	* @param MeshFacts - The analysis of the mesh we want to validate
 	* @param LodIndex - The lod of the static mesh that we want to validate
 	* @param Message - Any Messages which we want to store from within the validation
 	* @return The ValidationStatus of the actual check.
 	*/
-	static EValidationStatus ValidateLightmapUVs(UStaticMesh* StaticMesh, const int LodIndex, FString& Message);
+	static EValidationStatus ValidateLightmapUVs(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message);
 };
@@ -0,0 +1,60 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
+#include "Validation_Level_NDisplay_Mesh_UVLayout.generated.h"
+
+/**
+* Validation to ensure that any meshes which are being used as part of an NDisplay configuration, have no overlapping
+* or flipped triangles in their UVs. Overlapping islands cause the same area of the wall to display the same content
+* and flipped triangles mirror it, both produce artifacts similar to UVs outside of the 0-1 range
+*/
+UCLASS()
+class VALIDATIONFRAMEWORK_API UValidation_Level_NDisplay_Mesh_UVLayout final: public UValidationBase
+{
+	GENERATED_BODY()
+public:
+	UValidation_Level_NDisplay_Mesh_UVLayout();
+
+	virtual FValidationResult Validation_Implementation() override;
+	virtual FValidationFixResult Fix_Implementation() override;
+
+	/**
+	* Function to run the actual validation check for overlapping and flipped uvs in the channel nDisplay projects
+	* through. This function is run against the shared NDisplay mesh analysis. The island count of a failing channel is
+	* included to help find the problem
+	* @param MeshFacts - The analysis of the mesh we want to validate
+	* @param LodIndex - The lod of the static mesh that we want to validate
+	* @param UVChannel - The uv channel nDisplay projects through
+	* @param MaxOverlapPercent - The largest percentage of the uv space which overlapping uvs may cover
+	* @param Message - Any Messages which we want to store from within the validation
+	* @return The ValidationStatus of the actual check.
+	*/
+	static EValidationStatus ValidateUVLayout(const FValidationMeshFacts& MeshFacts, const int LodIndex,
+		const int32 UVChannel, const float MaxOverlapPercent, FString& Message);
+
+	/**
+	* Runs the check against the NDisplay meshes in the world, using the projection channel and overlap tolerance from
+	* the project settings
+	* @param World - The UWorld we are operating within
+	* @return The combined ValidationResult
+	*/
+	static FValidationResult ValidateNDisplayMeshes(const UWorld* World);
+};
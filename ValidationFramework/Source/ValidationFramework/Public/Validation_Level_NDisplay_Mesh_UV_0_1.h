@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "CoreMinimal.h"
 #include "ValidationBase.h"
+#include "ValidationMeshAnalysis.h"
 #include "Validation_Level_NDisplay_Mesh_UV_0_1.generated.h"
 
 /**
@@ -35,12 +36,12 @@ public:
 	virtual FValidationFixResult Fix_Implementation() override;
 
 	/**
-	* Function to run the actual validation check for uvs outside of 0-1 range. This function is passed to a generic
-	* NDisplay mesh validation. 
-	* @param StaticMesh - The mesh we want to validate
+	* Function to run the actual validation check for uvs outside of 0-1 range. This function is run against the shared
+	* NDisplay mesh analysis. Every channel is checked in full, reporting how many uvs are out of range and their bounds
+	* @param MeshFacts - The analysis of the mesh we want to validate
 	* @param LodIndex - The lod of the static mesh that we want to validate
 	* @param Message - Any Messages which we want to store from within the validation
 	* @return The ValidationStatus of the actual check.
 	*/
-	static EValidationStatus ValidateUVs(UStaticMesh* StaticMesh, const int LodIndex, FString& Message);
+	static EValidationStatus ValidateUVs(const FValidationMeshFacts& MeshFacts, const int LodIndex, FString& Message);
 };
@@ -20,10 +20,12 @@ limitations under the License.
 #include "CoreMinimal.h"
 #include "OpenColorIOColorSpace.h"
 #include "ValidationBase.h"
+#include "ValidationOCIOResolver.h"
 
 #if PLATFORM_WINDOWS || PLATFORM_LINUX
 #include "DisplayClusterConfigurationTypes_ICVFX.h"
 #include "Components/DisplayClusterICVFXCameraComponent.h"
+#include "ValidationNDisplayNameIndex.h"
 #endif
 
 #include "Validation_Level_NDisplay_OCIO.generated.h"
@@ -49,57 +51,96 @@ public:
 	* @param OCIOObjectName - The name of the object and or component owning the settings
 	* @param HardFail - How strict do we want to be, a hard fail causes a Fail other wise a warning
 	*/
-	void ValidateOCIOColorConversionSettings(FValidationResult& ValidationResult,
-	                                         FOpenColorIOColorConversionSettings OCIOSettings1,
-	                                         FOpenColorIOColorConversionSettings OCIOSettings2, FString OCIOObjectName,
-	                                         bool HardFail = true);
+	static void ValidateOCIOColorConversionSettings(FValidationResult& ValidationResult,
+	                                                const FOpenColorIOColorConversionSettings& OCIOSettings1,
+	                                                const FOpenColorIOColorConversionSettings& OCIOSettings2,
+	                                                const FString& OCIOObjectName,
+	                                                bool HardFail = true);
 	
+	/**
+	* Compares two OCIO Color Conversion Settings, numerically when the project settings ask for OCIO transforms to be
+	* compared numerically, otherwise by name through ValidateOCIOColorConversionSettings
+	* @param ValidationResult - The validation status to be updated
+	* @param OCIOResolver - The resolver memoizing the OCIO conversions resolved within the run
+	* @param OCIOSettings1 - The OCIO color conversion settings we want to compare with
+	* @param OCIOSettings2 - The OCIO color conversion settings we want to compare with
+	* @param OCIOObjectName - The name of the object and or component owning the settings
+	* @param HardFail - How strict do we want to be, a hard fail causes a Fail other wise a warning
+	*/
+	static void CompareOCIOColorConversionSettings(FValidationResult& ValidationResult,
+	                                               FValidationOCIOResolver& OCIOResolver,
+	                                               const FOpenColorIOColorConversionSettings& OCIOSettings1,
+	                                               const FOpenColorIOColorConversionSettings& OCIOSettings2,
+	                                               const FString& OCIOObjectName,
+	                                               bool HardFail = true);
+
 	/**
 	* Validates the OCIO setup for the outer frustum compared to the project setup
 	* @param ValidationResult - The validation status to be updated
+	* @param OCIOResolver - The resolver memoizing the OCIO conversions resolved within the run
 	* @param ProjectOCIOSettings - The OCIO Settings defined for the project in the validation framework settings
 	* @param OCIOObjectName - The name of the object and or component owning the settings
 	* @param StageSettings - The StageSettings we are validating
 	*/
-	void ValidateAllViewportOCIOSetups(FValidationResult& ValidationResult,
-	                                    FOpenColorIOColorConversionSettings ProjectOCIOSettings, FString OCIOObjectName,
-	                                    FDisplayClusterConfigurationICVFX_StageSettings StageSettings);
+	static void ValidateAllViewportOCIOSetups(FValidationResult& ValidationResult,
+	                                          FValidationOCIOResolver& OCIOResolver,
+	                                          const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	                                          const FString& OCIOObjectName,
+	                                          const FDisplayClusterConfigurationICVFX_StageSettings& StageSettings);
 	
 	/**
-	* Validates the OCIO setup for the outer frustum per viewport overrides
+	* Validates a single OCIO per viewport override for the outer frustum
 	* @param ValidationResult - The validation status to be updated
+	* @param OCIOResolver - The resolver memoizing the OCIO conversions resolved within the run
 	* @param ProjectOCIOSettings - The OCIO Settings defined for the project in the validation framework settings
 	* @param OCIOObjectName - The name of the object and or component owning the settings
-	* @param StageSettings - The StageSettings we are validating
+	* @param Viewport_Idx - The index of the override within the stage settings
+	* @param PerViewportOCIOProfile - The override we are validating
+	* @param NameIndex - The index of the cluster nodes and viewports of the NDisplay setup owning the override
+	* @param ClaimedViewports - The viewports already claimed by an override of this setup, mapped to that override
 	*/
-	void ValidatePerViewportOCIOOverrideSetups(FValidationResult& ValidationResult,
-	                                           FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-	                                           FString OCIOObjectName,
-	                                           FDisplayClusterConfigurationICVFX_StageSettings StageSettings);
+	static void ValidatePerViewportOCIOOverrideSetup(FValidationResult& ValidationResult,
+	                                                 FValidationOCIOResolver& OCIOResolver,
+	                                                 const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	                                                 const FString& OCIOObjectName,
+	                                                 int32 Viewport_Idx,
+	                                                 const FDisplayClusterConfigurationOCIOProfile& PerViewportOCIOProfile,
+	                                                 const FValidationNDisplayNameIndex& NameIndex,
+	                                                 TMap<FString, int32>& ClaimedViewports);
 
 	/**
 	* Validates the OCIO setup for the inner frustum for the given ICVFX camera
 	* @param ValidationResult - The validation status to be updated
+	* @param OCIOResolver - The resolver memoizing the OCIO conversions resolved within the run
 	* @param ProjectOCIOSettings - The OCIO Settings defined for the project in the validation framework settings
 	* @param ComponentName - The name of the object and or component owning the settings
 	* @param Icvfx_CameraSettings - The ICVFX Camera settings we are validating
 	*/
-	void ValidateInnerFrustumOCIOSetups(FValidationResult& ValidationResult,
-	                                    FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-	                                    FString ComponentName,
-	                                    FDisplayClusterConfigurationICVFX_CameraSettings Icvfx_CameraSettings);
+	static void ValidateInnerFrustumOCIOSetups(FValidationResult& ValidationResult,
+	                                           FValidationOCIOResolver& OCIOResolver,
+	                                           const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	                                           const FString& ComponentName,
+	                                           const FDisplayClusterConfigurationICVFX_CameraSettings& Icvfx_CameraSettings);
 
 	/**
-	* Validates the OCIO setup for the inner frustum per node setups for the given ICVFX camera
+	* Validates a single OCIO per node setup for the inner frustum of an ICVFX camera
 	* @param ValidationResult - The validation status to be updated
+	* @param OCIOResolver - The resolver memoizing the OCIO conversions resolved within the run
 	* @param ProjectOCIOSettings - The OCIO Settings defined for the project in the validation framework settings
 	* @param ComponentName - The name of the object and or component owning the settings
-	* @param Icvfx_CameraSettings - The ICVFX Camera settings we are validating
+	* @param PerNodeIndex - The index of the per node setup within the camera settings
+	* @param PerNodeOCIOProfile - The per node setup we are validating
+	* @param NameIndex - The index of the cluster nodes and viewports of the NDisplay setup owning the camera
+	* @param ClaimedNodes - The nodes already claimed by a per node setup of this camera, mapped to that setup
 	*/
-	void ValidateInnerFrustumOCIOPerNodeSetups(FValidationResult& ValidationResult,
-										FOpenColorIOColorConversionSettings ProjectOCIOSettings,
-										FString ComponentName,
-										FDisplayClusterConfigurationICVFX_CameraSettings Icvfx_CameraSettings);
+	static void ValidateInnerFrustumOCIOPerNodeSetup(FValidationResult& ValidationResult,
+	                                                 FValidationOCIOResolver& OCIOResolver,
+	                                                 const FOpenColorIOColorConversionSettings& ProjectOCIOSettings,
+	                                                 const FString& ComponentName,
+	                                                 int32 PerNodeIndex,
+	                                                 const FDisplayClusterConfigurationOCIOProfile& PerNodeOCIOProfile,
+	                                                 const FValidationNDisplayNameIndex& NameIndex,
+	                                                 TMap<FString, int32>& ClaimedNodes);
 #endif
 	virtual FValidationResult Validation_Implementation() override;
 	
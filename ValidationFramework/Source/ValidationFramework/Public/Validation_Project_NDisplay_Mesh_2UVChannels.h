@@ -0,0 +1,49 @@
+/**
+Copyright 2022 Netflix, Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ValidationBase.h"
+#include "ValidationMeshAssetAudit.h"
+#include "Validation_Project_NDisplay_Mesh_2UVChannels.generated.h"
+
+/**
+* Validation to ensure that every mesh used by any of the nDisplay configs in the project has 2 UV channels, not just
+* those in the open level. The asset registry tags hold the uv channels of LOD 0, so only meshes with the right number
+* of channels in LOD 0 and further LODs to check need to be loaded
+*/
+UCLASS()
+class VALIDATIONFRAMEWORK_API UValidation_Project_NDisplay_Mesh_2UVChannels final : public UValidationBase
+{
+	GENERATED_BODY()
+
+public:
+	UValidation_Project_NDisplay_Mesh_2UVChannels();
+	
+	virtual FValidationResult Validation_Implementation() override;
+	virtual FValidationFixResult Fix_Implementation() override;
+
+	/**
+	* Function to answer the validation from the asset registry tags of the mesh where possible
+	* @param Tags - The tags of the mesh we want to validate
+	* @param PathName - The path of the mesh we want to validate
+	* @param OutStatus - The ValidationStatus of the check, when answered
+	* @param Message - Any Messages which we want to store from within the validation
+	* @return Whether the tags answered the check
+	*/
+	static bool ValidateMeshTags(const FValidationMeshAssetTags& Tags, const FString& PathName, EValidationStatus& OutStatus, FString& Message);
+};
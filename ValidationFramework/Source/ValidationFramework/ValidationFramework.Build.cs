@@ -42,18 +42,22 @@ public class ValidationFramework : ModuleRules
 				"TimeManagement",
 				"SlateCore", "EditorScriptingUtilities", "UMG", "EngineSettings", "UMGEditor", 
 				"LevelSequence", "SettingsEditor", "SettingsEditor", "MediaPlate", "MediaAssets", "MediaUtils", 
-				"ImgMedia","MovieScene", "WindowsTargetPlatformSettings",
+				"ImgMedia","MovieScene", "WindowsTargetPlatformSettings", "EditorSubsystem", "Json", "JsonUtilities",
+				"MeshDescription", "StaticMeshDescription", "ImageCore", "OpenColorIOWrapper",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
 
-		if (Target.Platform == UnrealTargetPlatform.Win64)
+		if (Target.Platform == UnrealTargetPlatform.Win64 || Target.Platform == UnrealTargetPlatform.Linux)
 		{
 			PrivateDependencyModuleNames.Add("DisplayCluster");
 			PrivateDependencyModuleNames.Add("DisplayClusterConfiguration");
-			PrivateDependencyModuleNames.Add("WindowsTargetPlatform");
 			PrivateDependencyModuleNames.Add("CinematicCamera");
+		}
 
+		if (Target.Platform == UnrealTargetPlatform.Win64)
+		{
+			PrivateDependencyModuleNames.Add("WindowsTargetPlatform");
 		}
 		
 		